@@ -0,0 +1,154 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5AGGREGATINGWRITER_HPP
+#define H5AGGREGATINGWRITER_HPP
+
+#include <type_traits>
+#include <vector>
+
+#include "H5DataSet.hpp"
+
+#ifdef H5GT_PARALLEL
+
+#include <mpi.h>
+
+namespace h5gt {
+
+namespace details {
+
+// owns a duplicate of user's communicator: collectives of the writer
+// never match user's messages and the writer may outlive `comm`
+class MPICommDup {
+public:
+  explicit MPICommDup(MPI_Comm comm) {
+    MPI_Comm_dup(comm, &_comm);
+  }
+
+  MPICommDup(MPICommDup&& other) noexcept : _comm(other._comm) {
+    other._comm = MPI_COMM_NULL;
+  }
+
+  MPICommDup(const MPICommDup&) = delete;
+  MPICommDup& operator=(const MPICommDup&) = delete;
+  MPICommDup& operator=(MPICommDup&&) = delete;
+
+  ~MPICommDup() {
+    if (_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&_comm);
+  }
+
+  operator MPI_Comm() const noexcept {
+    return _comm;
+  }
+
+private:
+  MPI_Comm _comm = MPI_COMM_NULL;
+};
+
+}  // namespace details
+
+///
+/// \brief Two-phase writer for many small hyperslabs per rank
+/// of a dataset in a file opened with `MPIOFileDriver`.
+///
+/// `write` only buffers the box. `flush` (collective over `comm`)
+/// splits the dataset along its first axis into one file domain per
+/// aggregator rank, sends every buffered box (split at domain
+/// boundaries) to the aggregator owning it with a single `MPI_Alltoallv`
+/// and then each aggregator writes everything it received with one
+/// collective `H5Dwrite`. Thousands of tiny MPI-IO requests thus become
+/// a few large ones.
+///
+/// Domain boundaries are aligned to chunks along the first axis for chunked
+/// datasets (a chunk is written by a single aggregator) and to `alignment`
+/// bytes of the file (i.e. file system stripe size) for contiguous ones.
+/// An aggregator allocates the bounding box of the boxes it receives,
+/// call `flush` more often to bound memory. Where boxes overlap the one
+/// written later wins, boxes of higher ranks win over boxes of lower ranks.
+///
+template <typename T>
+class AggregatingWriter {
+  static_assert(std::is_trivially_copyable<T>::value,
+      "AggregatingWriter requires trivially copyable elements");
+
+public:
+  ///
+  /// \brief Constructor is collective over `comm`. The writer works on
+  /// a duplicate of `comm` and must be destroyed before `MPI_Finalize`
+  /// \param dset dataset of a file opened with `MPIOFileDriver` by all ranks of `comm`
+  /// \param comm communicator
+  /// \param nAggregators number of aggregator ranks evenly spread among ranks
+  /// (0 - one per shared memory node)
+  /// \param alignment file domain alignment in bytes for contiguous datasets
+  /// \param xferProps data transfer properties of aggregators write
+  /// (collective transfer mode is set if it is default)
+  AggregatingWriter(const DataSet& dset, MPI_Comm comm,
+                    int nAggregators = 0,
+                    size_t alignment = size_t(1) << 20,
+                    const DataTransferProps& xferProps = DataTransferProps::Default());
+
+  AggregatingWriter(AggregatingWriter&& other) noexcept = default;
+
+  AggregatingWriter(const AggregatingWriter&) = delete;
+  AggregatingWriter& operator=(const AggregatingWriter&) = delete;
+  AggregatingWriter& operator=(AggregatingWriter&&) = delete;
+
+  ///
+  /// \brief Buffer row-major box of `count` elements at `offset`.
+  /// The box must fit dataset extent known to the writer
+  void write(const T* buffer,
+             const std::vector<size_t>& offset,
+             const std::vector<size_t>& count);
+
+  void write(const std::vector<T>& buffer,
+             const std::vector<size_t>& offset,
+             const std::vector<size_t>& count);
+
+  ///
+  /// \brief Redistribute buffered boxes and write them (collective over `comm`)
+  void flush();
+
+  /// \brief Number of buffered elements on this rank
+  size_t getBufferedSize() const noexcept;
+
+  /// \brief Ranks of aggregators
+  const std::vector<int>& getAggregators() const noexcept;
+
+  bool isAggregator() const noexcept;
+
+  /// \brief Boundaries of file domains along the first axis: aggregator `i`
+  /// writes rows `[domains[i], domains[i + 1])`. Domains are recomputed
+  /// after each `flush` in case the dataset was resized
+  const std::vector<size_t>& getDomains() const noexcept;
+
+  const DataSet& getDataSet() const noexcept;
+
+private:
+  void _updateDomains();
+  size_t _domainOf(size_t row) const;
+
+  DataSet _dset;
+  DataTransferProps _xfer;
+  details::MPICommDup _comm;
+  int _rank = 0;
+  int _size = 1;
+  size_t _alignment = 1;
+  std::vector<int> _aggregators;
+  int _aggregatorIndex = -1;  // index of this rank in `_aggregators`
+  std::vector<size_t> _dims;
+  std::vector<size_t> _domains;  // `_aggregators.size() + 1` boundaries
+  std::vector<unsigned long long> _boxes;  // offset and count of each box
+  std::vector<T> _buffer;
+};
+
+}  // namespace h5gt
+
+#include "bits/H5AggregatingWriter_misc.hpp"
+
+#endif // H5GT_PARALLEL
+
+#endif // H5AGGREGATINGWRITER_HPP
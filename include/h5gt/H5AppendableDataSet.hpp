@@ -0,0 +1,125 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5APPENDABLEDATASET_HPP
+#define H5APPENDABLEDATASET_HPP
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "H5File.hpp"
+
+namespace h5gt {
+
+///
+/// \brief Buffered writer appending records to a dataset along its
+/// unlimited `axis`.
+///
+/// A record is a slice of the dataset at a fixed position along `axis`
+/// (a single value for 1D streams, a row for 2D datasets appended along
+/// the first axis etc.). Records are buffered in memory and written by
+/// chunk aligned blocks with a single `H5Dwrite`. The dataset extent grows
+/// geometrically (it is doubled) so appending `n` records costs `O(log n)`
+/// resizes. The extent is trimmed to the number of appended records
+/// by `close()` (or the destructor): before that readers may see
+/// fill values at the end of the dataset.
+///
+template <typename T>
+class AppendableDataSet {
+  static_assert(std::is_trivially_copyable<T>::value,
+      "AppendableDataSet requires trivially copyable records");
+
+public:
+  ///
+  /// \brief Create a new dataset with unlimited `axis`
+  /// \param node File or Group where the dataset is created
+  /// \param dataset_name identifier of the dataset
+  /// \param recordDims dimensions of a record (empty for 1D streams)
+  /// \param axis append axis (`0 <= axis <= recordDims.size()`)
+  /// \param chunkRecords number of records in a chunk (0 - chunk of about 64 KiB).
+  /// Ignored if `dsetCreateProps` already sets the chunk
+  /// \param dsetCreateProps dataset creation properties (i.e. filters)
+  /// \param linkCreateProps link creation properties
+  template <typename Derivate>
+  static AppendableDataSet create(
+      NodeTraits<Derivate>& node,
+      const std::string& dataset_name,
+      const std::vector<size_t>& recordDims = std::vector<size_t>(),
+      size_t axis = 0,
+      size_t chunkRecords = 0,
+      const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+      const LinkCreateProps& linkCreateProps = LinkCreateProps::Default());
+
+  ///
+  /// \brief Append to an existing chunked dataset that is unlimited along `axis`.
+  /// Records are appended after `dset.getDimensions()[axis]` records.
+  /// \param dset dataset to append to
+  /// \param axis append axis
+  /// \param bufferRecords number of buffered records
+  /// (0 - at least one chunk and about 1 MiB)
+  explicit AppendableDataSet(const DataSet& dset, size_t axis = 0,
+                             size_t bufferRecords = 0);
+
+  AppendableDataSet(AppendableDataSet&& other) noexcept = default;
+
+  AppendableDataSet(const AppendableDataSet&) = delete;
+  AppendableDataSet& operator=(const AppendableDataSet&) = delete;
+  AppendableDataSet& operator=(AppendableDataSet&&) = delete;
+
+  /// \brief Calls `close()`, errors are ignored
+  ~AppendableDataSet();
+
+  /// \brief Append a single value (record size must be 1)
+  void append(const T& value);
+
+  /// \brief Append `records.size() / getRecordSize()` records
+  void append(const std::vector<T>& records);
+
+  /// \brief Append `nRecords` records stored one after another
+  /// (each record is row-major)
+  void append(const T* records, size_t nRecords = 1);
+
+  /// \brief Write buffered records (extent is not trimmed)
+  void flush();
+
+  /// \brief Write buffered records and trim the extent to `size()`.
+  /// Records may still be appended afterwards
+  void close();
+
+  /// \brief Number of records (written and buffered)
+  size_t size() const noexcept;
+
+  /// \brief Number of elements in a record
+  size_t getRecordSize() const noexcept;
+
+  size_t getAxis() const noexcept;
+
+  const DataSet& getDataSet() const noexcept;
+
+private:
+  void _write(const T* records, size_t nRecords);
+  void _reserve(size_t nRecords);
+  void _resize(size_t nRecords);
+  void _updateFlushTarget() noexcept;
+
+  DataSet _dset;
+  std::vector<size_t> _dims;  // current extent
+  size_t _axis = 0;
+  size_t _outer = 1;  // number of elements before `axis`
+  size_t _inner = 1;  // number of elements after `axis`
+  size_t _chunk = 1;  // chunk size along `axis`
+  size_t _capacity = 1;  // buffer capacity in records
+  size_t _written = 0;  // records written to the dataset
+  size_t _target = 0;  // flush when `_written + buffered` reaches it
+  std::vector<T> _buffer, _scratch;
+};
+
+}  // namespace h5gt
+
+#include "bits/H5AppendableDataSet_misc.hpp"
+
+#endif // H5APPENDABLEDATASET_HPP
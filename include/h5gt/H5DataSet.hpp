@@ -9,6 +9,7 @@
 #ifndef H5DATASET_HPP
 #define H5DATASET_HPP
 
+#include <memory>
 #include <vector>
 
 #include "H5DataSpace.hpp"
@@ -20,6 +21,79 @@
 
 namespace h5gt {
 
+///
+/// \brief Location and size of a chunk of a chunked dataset
+///
+class ChunkInfo {
+public:
+  /// \brief Logical offset of the chunk (in elements)
+  const std::vector<size_t>& getOffset() const noexcept;
+
+  /// \brief Address of the chunk within its file
+  /// (`HADDR_UNDEF` if the chunk is not allocated)
+  haddr_t getAddress() const noexcept;
+
+  /// \brief Stored (i.e. compressed) size of the chunk in bytes
+  hsize_t getStorageSize() const noexcept;
+
+  /// \brief Bit `i` is set if filter `i` was skipped for this chunk
+  unsigned getFilterMask() const noexcept;
+
+  bool isAllocated() const noexcept;
+
+protected:
+  std::vector<size_t> offset;
+  haddr_t address = HADDR_UNDEF;
+  hsize_t storage_size = 0;
+  unsigned filter_mask = 0;
+
+  friend class DataSet;
+};
+
+///
+/// \brief Read-only N-D view of dataset values returned by
+/// `DataSet::mapReadOnly()`. Values are either memory mapped from
+/// the file or read to a buffer owned by the view.
+/// The view stays valid after the dataset/file is closed.
+///
+template <typename T>
+class DataSetView {
+public:
+  /// \brief Row-major values
+  const T* data() const noexcept;
+
+  const std::vector<size_t>& getDimensions() const noexcept;
+
+  /// \brief Total number of elements
+  size_t size() const noexcept;
+
+  /// \brief Whether values are memory mapped from the file
+  bool isMapped() const noexcept;
+
+  const T& operator[](size_t i) const noexcept;
+
+  /// \brief Element at N-D index (the number of indices must be equal
+  /// to the number of dimensions)
+  template <typename... Idx>
+  const T& operator()(Idx... idx) const noexcept;
+
+#ifdef H5GT_USE_EIGEN
+  using EigenMap = Eigen::Map<
+      const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+  /// \brief Row-major matrix view of 1D (column vector) or 2D data
+  EigenMap asEigen() const;
+#endif
+
+protected:
+  std::shared_ptr<const void> _holder;
+  const T* _data = nullptr;
+  std::vector<size_t> _dims;
+  bool _mapped = false;
+
+  friend class DataSet;
+};
+
 ///
 /// \brief Class representing a dataset.
 ///
@@ -81,10 +155,10 @@ public:
   /// \return
   ///
   bool rename(const std::string& dest_path,
-              const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-              const LinkAccessProps& linkAccessProps = LinkAccessProps()) const;
+              const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+              const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const;
 
-  Group getParent(const GroupAccessProps& groupAccessProps = GroupAccessProps()) const;
+  Group getParent(const GroupAccessProps& groupAccessProps = GroupAccessProps::Default()) const;
 
   DataSetCreateProps getCreateProps() const;
   DataSetAccessProps getAccessProps() const;
@@ -96,6 +170,59 @@ public:
   /// \param dims New size of the dataset
   void resize(const std::vector<size_t>& dims);
 
+  /// \brief Zero-copy read-only view of the whole dataset.
+  ///
+  /// The data is memory mapped from the file if the file is opened
+  /// read-only with the default (sec2) driver, the dataset is contiguous,
+  /// allocated and not external, and `T` is identical to the dataset type
+  /// (including byte order). Otherwise values are read with `H5Dread`
+  /// to a buffer owned by the view (see `DataSetView::isMapped`).
+  template <typename T>
+  DataSetView<T> mapReadOnly() const;
+
+  /// \brief Number of allocated chunks
+  size_t getNumberChunks() const;
+
+  /// \brief List allocated chunks
+  /// \param storageOrder if true then chunks are sorted by their address
+  /// in file, otherwise they go in logical (row-major) order
+  std::vector<ChunkInfo> listChunks(bool storageOrder = false) const;
+
+  /// \brief Call `func(const Selection& sel, const ChunkInfo& info)` for
+  /// each chunk of the dataset. `sel` selects the chunk (clipped to the
+  /// dataset extent) and is ready to be read/written.
+  /// Chunks that were never written are visited too (they have no address
+  /// and read as fill value).
+  /// \param storageOrder if true then allocated chunks are visited in the order
+  /// they are stored in file (followed by unallocated chunks) to reduce seeks,
+  /// otherwise in logical (row-major) order
+  template <typename F>
+  void forEachChunkBlock(F&& func, bool storageOrder = true) const;
+
+  /// \brief Write chunk aligned box of data with multi-threaded compression.
+  ///
+  /// The box is split into chunks that are shuffled/deflated by `nThreads`
+  /// worker threads and then written with `H5Dwrite_chunk` by the calling
+  /// thread. The file is the same as after `select(offset, count).write_raw(buffer)`.
+  /// Falls back to `write_raw` if the dataset isn't chunked, the box isn't
+  /// chunk aligned, memory datatype differs from the dataset datatype,
+  /// the dataset uses filters other than shuffle, deflate, `BitShuffleFilter`
+  /// and `DeltaFilter`, data transform is set or the file uses MPI-IO driver
+  /// (collective `write_raw` compresses chunks in parallel across ranks).
+  /// \param buffer row-major buffer of `count` elements
+  /// \param offset must be a multiple of chunk dims
+  /// \param count must be a multiple of chunk dims or reach the dataset extent
+  /// \param nThreads number of worker threads (0 - number of hardware threads)
+  /// \param dtype memory datatype, in case it cannot be automatically guessed
+  /// \param xferProps data transfer properties
+  template <typename T>
+  void writeParallel(const T* buffer,
+                     const std::vector<size_t>& offset,
+                     const std::vector<size_t>& count,
+                     size_t nThreads = 0,
+                     const DataType& dtype = DataType(),
+                     const DataTransferProps& xferProps = DataTransferProps::Default());
+
 
   /// \brief Get the dimensions of the whole DataSet.
   ///       This is a shorthand for getSpace().getDimensions()
@@ -135,6 +262,9 @@ protected:
   friend class Selection;
   template <typename Derivate> friend class NodeTraits;
 
+private:
+  /// \brief chunks covering the whole dataset extent
+  std::vector<ChunkInfo> _getChunks(bool storageOrder, bool allocatedOnly) const;
 };
 
 }  // namespace h5gt
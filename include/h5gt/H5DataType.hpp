@@ -9,9 +9,19 @@
 #ifndef H5DATATYPE_HPP
 #define H5DATATYPE_HPP
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "H5Object.hpp"
+#include "bits/H5Macros.hpp"
 #include "bits/H5Utils.hpp"
 
 namespace h5gt {
@@ -291,10 +301,86 @@ DataType create_datatype();
 
 
 /// \brief Create a DataType instance representing type T and perform a sanity check on its size
+/// The returned DataType is shared (see DataTypeRegistry) and must be treated as read-only
 template <typename T>
 DataType create_and_check_datatype();
 
 
+/// \brief Create a DataType of T without padding between members (see
+/// `H5Tpack()`) to be used as a file datatype. For types described with
+/// `H5GT_REFLECT` that have no padding it is the memory datatype itself:
+/// file and memory types match byte-for-byte and HDF5 doesn't convert data
+template <typename T>
+DataType create_packed_datatype();
+
+
+///
+/// \brief Process-wide cache of memory datatypes
+///
+/// Each C++ type is converted to HDF5 datatype only once (on first request)
+/// and then every caller shares the same HDF5 id. Handles returned by
+/// the registry must be treated as read-only: don't commit or modify them.
+/// Use `create_datatype<T>()` to get a private copy.
+///
+class DataTypeRegistry {
+public:
+  /// \brief Return shared DataType representing type T (see `create_datatype<T>()`)
+  template <typename T>
+  static DataType get();
+
+  /// \brief Same as `get()` but the size of the datatype is also checked
+  /// (see `create_and_check_datatype<T>()`). The check is done only once
+  template <typename T>
+  static DataType getChecked();
+
+  /// \brief Offsets of variable length string members of the datatype
+  /// returned by `get<T>()` (nested compounds are flattened). The layout
+  /// is computed once and cached along with the datatype
+  template <typename T>
+  static std::vector<size_t> getVLenStringOffsets();
+
+  /// \brief Close all cached datatypes so they are rebuilt on next request.
+  /// Must be called before closing HDF5 library (`H5close()`) or if a type
+  /// registered with `H5GT_REGISTER_TYPE` should be rebuilt
+  static void invalidate() noexcept;
+
+  /// \brief Drop all cached datatypes without closing them. Use it instead
+  /// of `invalidate()` only if HDF5 library has been already closed: ids of
+  /// cached datatypes are not valid anymore and may belong to other objects
+  static void forget() noexcept;
+
+  /// \brief Number of requests served from cache
+  static size_t getHitCount() noexcept;
+
+  /// \brief Number of requests that required to build a datatype
+  static size_t getMissCount() noexcept;
+
+  static void resetCounters() noexcept;
+
+private:
+  struct Slot {
+    std::unique_ptr<DataType> type;
+    std::vector<size_t> vlen_str_offsets;
+    size_t generation = 0;  // 0 means the slot is empty
+  };
+
+  template <typename T, bool Checked>
+  static DataType lookup(std::vector<size_t>* vlen_str_offsets = nullptr);
+
+  template <typename T, bool Checked>
+  static DataType build();
+
+  static Slot* addSlot();
+  static void clear(bool close) noexcept;
+
+  static std::mutex& mutex() noexcept;
+  static std::vector<Slot*>& slots() noexcept;
+  static std::atomic<size_t>& generation() noexcept;
+  static std::atomic<size_t>& hits() noexcept;
+  static std::atomic<size_t>& misses() noexcept;
+};
+
+
 ///
 /// \brief A structure representing a set of fixed-length strings
 ///
@@ -409,6 +495,131 @@ private:
   vector_t datavec;
 };
 
+
+///
+/// \brief A table of variable length strings stored in one contiguous
+/// char arena (each string is null terminated) along with the offsets
+/// of the strings. Strings are accessed as `std::string_view`.
+///
+/// Reading to StringTable (see `SliceTraits::read`) makes HDF5 allocate
+/// the strings from the arena instead of one `malloc` per string followed
+/// by a copy to `std::string` and `H5Dvlen_reclaim`.
+///
+class StringTable {
+public:
+  StringTable() = default;
+
+  ///
+  /// \brief Create a StringTable from a sequence of strings (copied)
+  ///
+  explicit StringTable(const std::vector<std::string>& vec);
+
+  StringTable(const std::initializer_list<std::string_view>& list);
+
+  ///
+  /// \brief Append a string to the arena
+  ///
+  void push_back(std::string_view str);
+
+  ///
+  /// \brief Null terminated strings pointers (valid until the table is
+  /// modified) i.e. to write the table as variable length strings
+  ///
+  std::vector<const char*> getCStrings() const;
+
+  // Container interface
+  inline std::string_view operator[](std::size_t i) const noexcept {
+    return std::string_view(_arena.data() + _offsets[i],
+                            _offsets[i + 1] - _offsets[i] - 1);
+  }
+  std::string_view at(std::size_t i) const;
+  inline bool empty() const noexcept {
+    return size() == 0;
+  }
+  inline std::size_t size() const noexcept {
+    return _offsets.size() - 1;
+  }
+  inline void clear() noexcept {
+    _arena.clear();
+    _offsets.assign(1, 0);
+  }
+  /// \brief the arena: `size()` null terminated strings
+  inline const char* data() const noexcept {
+    return _arena.data();
+  }
+  /// \brief offset of each string in the arena followed by the arena size
+  inline const std::vector<std::size_t>& getOffsets() const noexcept {
+    return _offsets;
+  }
+
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view*;
+    using reference = std::string_view;
+
+    const_iterator(const StringTable& table, std::size_t i) noexcept
+      : _table(&table), _i(i) {}
+
+    inline std::string_view operator*() const noexcept {
+      return (*_table)[_i];
+    }
+    inline const_iterator& operator++() noexcept {
+      ++_i;
+      return *this;
+    }
+    inline const_iterator operator++(int) noexcept {
+      const_iterator it(*this);
+      ++_i;
+      return it;
+    }
+    inline bool operator==(const const_iterator& other) const noexcept {
+      return _i == other._i;
+    }
+    inline bool operator!=(const const_iterator& other) const noexcept {
+      return _i != other._i;
+    }
+
+  private:
+    const StringTable* _table;
+    std::size_t _i;
+  };
+
+  inline const_iterator begin() const noexcept {
+    return const_iterator(*this, 0);
+  }
+  inline const_iterator end() const noexcept {
+    return const_iterator(*this, size());
+  }
+
+private:
+  friend class details::StringArena;
+
+  std::vector<char> _arena;
+  std::vector<std::size_t> _offsets = std::vector<std::size_t>(1, 0);
+};
+
+namespace details {
+
+// member of a struct described with `H5GT_REFLECT`
+struct reflected_member {
+  const char* name;
+  size_t offset;
+  size_t size;
+  bool packed;  // memory and packed datatypes of the member are the same
+  DataType (*datatype)();
+};
+
+// specialized by `H5GT_REFLECT`
+template <typename T>
+struct reflection {
+  static constexpr bool value = false;
+};
+
+}  // namespace details
+
 }  // namespace h5gt
 
 
@@ -436,6 +647,61 @@ private:
   return function();                                      \
   }                                                       \
 
+
+/// \brief Macro to describe a struct to h5gt and register it as a compound
+///
+/// Member names, offsets and types are taken from the struct at compile
+/// time. Nested structs must be described before the struct that holds
+/// them. Members are C++ types supported by h5gt (including `std::string`,
+/// `char[N]` as fixed-len string and other arrays `T[N]`, `std::array<T, N>`)
+/// and must be listed in declaration order (checked at compile time).
+/// The compound is built once and shared (see `DataTypeRegistry`).
+///
+/// Use `create_packed_datatype<type>()` as file datatype to store the
+/// struct without padding. `H5GT_REFLECT_PACKED` additionally checks that
+/// the struct has no padding: then memory and file datatypes are the same
+/// and data is copied by HDF5 as is.
+///
+/// This macro has to be called outside of any namespace.
+///
+/// \code{.cpp}
+/// struct Point { double x, y, z; };
+/// struct Well { char name[16]; Point head; std::array<double, 2> xy; };
+/// H5GT_REFLECT_PACKED(Point, x, y, z)
+/// H5GT_REFLECT(Well, name, head, xy)
+/// \endcode
+#define H5GT_REFLECT(type, ...)                                               \
+  template <>                                                                 \
+  struct h5gt::details::reflection<type> {                                    \
+    static constexpr bool value = true;                                       \
+    static constexpr std::array<h5gt::details::reflected_member,              \
+                                H5GT_PP_NARG(__VA_ARGS__)> members{{          \
+      H5GT_PP_FOR_EACH(H5GT_REFLECT_MEMBER, type, __VA_ARGS__)                \
+    }};                                                                       \
+    static constexpr bool is_packed =                                         \
+        h5gt::details::is_packed_layout(members, sizeof(type));               \
+  };                                                                          \
+  static_assert(std::is_standard_layout<type>::value,                         \
+                "H5GT_REFLECT: " #type " must be a standard layout type");    \
+  static_assert(h5gt::details::is_ordered_layout(                             \
+                  h5gt::details::reflection<type>::members, sizeof(type)),    \
+                "H5GT_REFLECT: members of " #type                             \
+                " must be listed in declaration order");                      \
+  H5GT_REGISTER_TYPE(type, h5gt::details::reflected_datatype<type>)
+
+/// \brief Same as `H5GT_REFLECT` and checks that `type` has no padding
+#define H5GT_REFLECT_PACKED(type, ...)                                        \
+  H5GT_REFLECT(type, __VA_ARGS__)                                             \
+  static_assert(h5gt::details::reflection<type>::is_packed,                   \
+                "H5GT_REFLECT_PACKED: " #type " has padding or members "      \
+                "that are not described");
+
+#define H5GT_REFLECT_MEMBER(type, field)                                      \
+  h5gt::details::reflected_member{                                            \
+    #field, offsetof(type, field), sizeof(type::field),                       \
+    h5gt::details::member_traits<decltype(type::field)>::packed,              \
+    &h5gt::details::member_traits<decltype(type::field)>::datatype},
+
 #include "bits/H5DataType_misc.hpp"
 
 #endif // H5DATATYPE_HPP
@@ -54,6 +54,8 @@ using h5gt::Attribute;
 using h5gt::AtomicType;
 using h5gt::DataSet;
 using h5gt::DataSetCreateProps;
+using h5gt::DataTransferProps;
+using h5gt::DataType;
 using h5gt::DataSpace;
 using h5gt::Exception;
 using h5gt::File;
@@ -108,6 +110,7 @@ private:
 /// - Flush::True
 /// - Compression(false)
 /// - ChunkSize: automatic.
+/// - DataTransferProps: HDF5 defaults.
 class DumpOptions
 {
 public:
@@ -117,7 +120,7 @@ public:
 
   ///
   /// \brief Constructor: overwrite (some of the) defaults.
-  /// \param Any of DumpMode, Flush, Compression in arbitrary number and order.
+  /// \param Any of DumpMode, Flush, Compression, DataTransferProps in arbitrary number and order.
   template <class... Args>
   DumpOptions(Args... args)
   {
@@ -139,9 +142,14 @@ public:
   /// \param level Compression.
   inline void set(const Compression& level);
 
+  ///
+  /// \brief Overwrite setting.
+  /// \param xferProps DataTransferProps used to write the data.
+  inline void set(const DataTransferProps& xferProps);
+
   ///
   /// \brief Overwrite settings.
-  /// \param Any of DumpMode, Flush, Compression in arbitrary number and order.
+  /// \param Any of DumpMode, Flush, Compression, DataTransferProps in arbitrary number and order.
   template <class T, class... Args>
   inline void set(T arg, Args... args);
 
@@ -180,11 +188,16 @@ public:
   /// \brief Get chunk size.
   inline std::vector<hsize_t> getChunkSize() const;
 
+  ///
+  /// \brief Get data transfer properties.
+  inline const DataTransferProps& getTransferProps() const;
+
 private:
   bool m_overwrite = false;
   bool m_flush = true;
   unsigned m_compression_level = 0;
   std::vector<hsize_t> m_chunk_size = {};
+  DataTransferProps m_xfer_props = DataTransferProps::Default();
 };
 
 ///
@@ -328,6 +341,40 @@ inline T load(const File& file, const std::string& path, const std::vector<size_
 template <class T>
 inline T load(const File& file, const std::string& path);
 
+///
+/// \brief Load a DataSet in an open HDF5 file to an object (templated).
+///
+/// \param file opened File (has to be writeable)
+/// \param path path of the DataSet
+/// \param xferProps data transfer properties
+///
+/// \return the read data
+///
+/// The properties type is a template parameter so that `load<T>(file, path, {i})`
+/// keeps resolving to the overload taking indices.
+///
+template <class T, class P,
+          typename std::enable_if<std::is_same<P, DataTransferProps>::value, int>::type = 0>
+inline T load(const File& file,
+              const std::string& path,
+              const P& xferProps);
+
+///
+/// \brief Load entry "(i,j)" from a rank-two DataSet in an open HDF5 file to a scalar.
+///
+/// \param file opened File (has to be writeable)
+/// \param idx the indices to load
+/// \param path path of the DataSet
+/// \param xferProps data transfer properties
+///
+/// \return the read data
+///
+template <class T>
+inline T load(const File& file,
+              const std::string& path,
+              const std::vector<size_t>& idx,
+              const DataTransferProps& xferProps);
+
 ///
 /// \brief Write object (templated) to a (new) Attribute in an open HDF5 file.
 ///
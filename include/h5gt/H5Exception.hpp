@@ -140,6 +140,14 @@ class ReferenceException : public Exception {
 public:
   ReferenceException(const std::string& err_msg) : Exception(err_msg) {}
 };
+
+///
+/// \brief Exception specific to h5gt Filter interface
+///
+class FilterException : public Exception {
+public:
+  FilterException(const std::string& err_msg) : Exception(err_msg) {}
+};
 }
 
 #include "bits/H5Exception_misc.hpp"
@@ -56,14 +56,41 @@ public:
   /// \param filename: filepath of the HDF5 file
   /// \param openFlags: Open mode / flags ( ReadOnly, ReadWrite)
   /// \param fileAccessProps: the file access properties
+  /// \param fileCreateProps: the file creation properties
+  /// (used only if the file is created)
   ///
   /// Open or create a new HDF5 file
   explicit File(const std::string& filename, unsigned openFlags = ReadOnly,
-                const FileAccessProps& fileAccessProps = FileDriver());
+                const FileAccessProps& fileAccessProps = FileAccessProps::Default(),
+                const FileCreateProps& fileCreateProps = FileCreateProps::Default());
 
   bool operator==(const File& other) const;
   bool operator!=(const File& other) const;
 
+  /// \brief Current metadata cache configuration
+  /// (see `FileAccessProps::setMdcConfig`)
+  H5AC_cache_config_t getMdcConfig() const;
+
+  /// \brief Change metadata cache configuration of the opened file
+  void setMdcConfig(const H5AC_cache_config_t& config) const;
+
+  /// \brief Metadata cache hit rate (0 - 1) since the file was opened or
+  /// `resetMdcHitRateStats()` was called
+  double getMdcHitRate() const;
+
+  /// \brief Reset metadata cache hit rate statistics
+  void resetMdcHitRateStats() const;
+
+  /// \brief Metadata cache current size in bytes
+  size_t getMdcSize() const;
+
+  /// \param maxSize maximum cache size
+  /// \param minCleanSize minimum size of clean entries
+  /// \param curSize current cache size
+  /// \param curNumEntries current number of entries
+  void getMdcSize(size_t& maxSize, size_t& minCleanSize,
+                  size_t& curSize, int& curNumEntries) const;
+
   static File FromId(const hid_t& id, const bool& increaseRefCount = false){
     Object obj = Object(id, ObjectType::File, increaseRefCount);
     return File(obj);
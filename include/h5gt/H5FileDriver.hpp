@@ -9,6 +9,8 @@
 #ifndef H5FILEDRIVER_HPP
 #define H5FILEDRIVER_HPP
 
+#include <string>
+
 #include "H5PropertyList.hpp"
 
 #ifdef H5_HAVE_PARALLEL
@@ -22,6 +24,87 @@ namespace h5gt {
 ///
 class FileDriver : public FileAccessProps {};
 
+///
+/// \brief Default POSIX (sec2) driver with file space alignment:
+/// any object of at least `threshold` bytes (i.e. contiguous dataset
+/// or chunk) is aligned to a multiple of `alignment`.
+/// Aligning to the file system block (or RAID stripe) size avoids
+/// read-modify-write of partial blocks
+///
+class Sec2FileDriver : public FileDriver {
+public:
+  explicit Sec2FileDriver(hsize_t threshold = 1, hsize_t alignment = 1);
+};
+
+///
+/// \brief Core driver: the file is kept entirely in memory.
+/// Useful for scratch files that never have to reach the disk
+///
+class CoreFileDriver : public FileDriver {
+public:
+  /// \param increment size in bytes by which memory is grown
+  /// \param backingStore write the file to disk on close
+  /// (an existing file is read to memory on open anyway)
+  explicit CoreFileDriver(size_t increment = size_t(1) << 20,
+                          bool backingStore = false);
+
+  size_t getIncrement();
+  bool getBackingStore();
+};
+
+///
+/// \brief Family driver: the file is split into members of fixed size.
+/// File name must contain printf-style integer format, i.e. `data-%d.h5`
+///
+class FamilyFileDriver : public FileDriver {
+public:
+  /// \param memberSize size of each member file in bytes
+  /// \param memberProps file access properties of members
+  explicit FamilyFileDriver(
+      hsize_t memberSize,
+      const FileAccessProps& memberProps = FileAccessProps::Default());
+
+  hsize_t getMemberSize();
+};
+
+///
+/// \brief Split driver: metadata and raw data are stored in separate files
+/// `<name><metaExt>` and `<name><rawExt>` so that metadata may be kept on
+/// faster storage (i.e. using symlink)
+///
+class SplitFileDriver : public FileDriver {
+public:
+  /// \param metaExt metadata file extension
+  /// \param rawExt raw data file extension
+  /// \param metaProps file access properties of metadata file
+  /// \param rawProps file access properties of raw data file
+  explicit SplitFileDriver(
+      const std::string& metaExt = "-m.h5",
+      const std::string& rawExt = "-r.h5",
+      const FileAccessProps& metaProps = FileAccessProps::Default(),
+      const FileAccessProps& rawProps = FileAccessProps::Default());
+};
+
+#ifdef H5_HAVE_DIRECT
+
+///
+/// \brief Direct driver: POSIX driver with `O_DIRECT` that bypasses
+/// the system page cache (only available if HDF5 is built with it)
+///
+class DirectFileDriver : public FileDriver {
+public:
+  /// \param alignment memory alignment of I/O buffers
+  /// \param blockSize file system block size
+  /// \param cbufSize size of copy buffer
+  explicit DirectFileDriver(size_t alignment = 4096,
+                            size_t blockSize = 4096,
+                            size_t cbufSize = size_t(16) << 20);
+
+  void getFaplDirect(size_t& alignment, size_t& blockSize, size_t& cbufSize);
+};
+
+#endif
+
 
 #ifdef H5GT_PARALLEL
 
@@ -0,0 +1,131 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5FILTER_HPP
+#define H5FILTER_HPP
+
+#include <string>
+#include <vector>
+
+#include <H5Zpublic.h>
+
+#include "H5Exception.hpp"
+
+namespace h5gt {
+
+///
+/// \brief Filter of a dataset filter pipeline
+/// (see `DataSetCreateProps::getFilters`)
+///
+class FilterInfo {
+public:
+  H5Z_filter_t getId() const noexcept;
+
+  /// \brief `H5Z_FLAG_MANDATORY` or `H5Z_FLAG_OPTIONAL`
+  unsigned getFlags() const noexcept;
+
+  bool isOptional() const noexcept;
+
+  /// \brief Auxiliary data of the filter (i.e. compression level)
+  const std::vector<unsigned>& getCdValues() const noexcept;
+
+  const std::string& getName() const noexcept;
+
+  /// \brief Bit field of `H5Z_FILTER_CONFIG_ENCODE_ENABLED` and
+  /// `H5Z_FILTER_CONFIG_DECODE_ENABLED`
+  unsigned getFilterConfig() const noexcept;
+
+protected:
+  H5Z_filter_t id = H5Z_FILTER_ERROR;
+  unsigned flags = 0;
+  std::vector<unsigned> cd_values;
+  std::string name;
+  unsigned filter_config = 0;
+
+  friend class DataSetCreateProps;
+};
+
+///
+/// \brief Vectorized byte transposition identical to HDF5 shuffle filter.
+/// HDF5 doesn't allow to replace predefined filters so it is not registered:
+/// datasets use it through `DataSetCreateProps::setShuffle` and it encodes/
+/// decodes chunks in `DataSet::writeParallel` and `SliceTraits::readParallel`
+///
+struct ByteShuffleFilter {
+  static constexpr H5Z_filter_t id = H5Z_FILTER_SHUFFLE;
+  static const char* name() noexcept { return "h5gt byte shuffle"; }
+  static void encode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize) noexcept;
+  static void decode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize) noexcept;
+};
+
+///
+/// \brief Bit transposition: bit `k` of every element is stored contiguously.
+/// Exposes slowly varying bits (i.e. exponent of floats) to the following
+/// compression filter. Elements that don't fill a block of 8 are stored as is
+///
+/// Ids of `BitShuffleFilter` and `DeltaFilter` are from the testing range
+/// (256-511) as their format is specific to h5gt. Other tools may use the
+/// same ids so h5gt recognizes its chunks by filter name and signature
+/// stored in filter values (see `registerFilter<Codec>()`)
+///
+struct BitShuffleFilter {
+  static constexpr H5Z_filter_t id = 311;
+  static const char* name() noexcept { return "h5gt bit shuffle"; }
+  static void encode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize);
+  static void decode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize);
+};
+
+///
+/// \brief Difference of successive elements treated as little-endian
+/// unsigned integers (wrap-around arithmetic, lossless for any type).
+/// Suits smooth integer data, followed by a compression filter
+///
+struct DeltaFilter {
+  static constexpr H5Z_filter_t id = 312;
+  static const char* name() noexcept { return "h5gt delta"; }
+  static void encode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize) noexcept;
+  static void decode(const char* src, char* dst,
+                     size_t nbytes, size_t elemSize) noexcept;
+};
+
+///
+/// \brief Register filter class with HDF5 (a filter with the same id
+/// is replaced, predefined filters can't be replaced). Filters are registered
+/// for the process lifetime and must be registered by readers as well as writers
+void registerFilter(const H5Z_class2_t& filterClass);
+
+///
+/// \brief Register `Codec` that transforms a chunk without changing its size:
+/// - `static constexpr H5Z_filter_t id` filter identifier
+/// - `static const char* name()` filter name
+/// - `static void encode(const char* src, char* dst, size_t nbytes, size_t elemSize)`
+/// - `static void decode(const char* src, char* dst, size_t nbytes, size_t elemSize)`
+///
+/// `elemSize` is the size of dataset type (stored as the first filter value
+/// followed by h5gt signature). Chunks of a filter with the same id but
+/// without the signature (written by other tools) are not decoded
+template <typename Codec>
+void registerFilter();
+
+void unregisterFilter(H5Z_filter_t id);
+
+/// \brief Whether the filter is registered
+bool isFilterAvailable(H5Z_filter_t id);
+
+/// \brief Bit field of `H5Z_FILTER_CONFIG_ENCODE_ENABLED` and
+/// `H5Z_FILTER_CONFIG_DECODE_ENABLED`
+unsigned getFilterConfig(H5Z_filter_t id);
+
+}  // namespace h5gt
+
+#include "bits/H5Filter_misc.hpp"
+
+#endif // H5FILTER_HPP
@@ -59,12 +59,12 @@ public:
   /// \return
   ///
   bool rename(const std::string& dest_path,
-              const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-              const LinkAccessProps& linkAccessProps = LinkAccessProps()) const{
+              const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+              const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const{
     return NodeTraits<Group>::rename(getPath(), dest_path, linkCreateProps, linkAccessProps);
   }
 
-  Group getParent(const GroupAccessProps& groupAccessProps = GroupAccessProps()) const {
+  Group getParent(const GroupAccessProps& groupAccessProps = GroupAccessProps::Default()) const {
     std::string path = getPath();
     if (path == "/")
       HDF5ErrMapper::ToException<GroupException>(
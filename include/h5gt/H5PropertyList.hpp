@@ -14,7 +14,12 @@
 
 #include <H5Ppublic.h>
 
+#ifdef H5_HAVE_PARALLEL
+#include <H5FDmpi.h>
+#endif
+
 #include "H5Exception.hpp"
+#include "H5Filter.hpp"
 #include "H5Object.hpp"
 
 namespace h5gt {
@@ -75,22 +80,27 @@ class PropertyList {
 
 public:
   ~PropertyList() {
-    if (_hid != H5P_DEFAULT) {
-      H5Pclose(_hid);
-    }
+    close();
   }
 
   PropertyList(const PropertyList<T>& other) :
     _hid(other.getId(true)){};
 
   PropertyList& operator=(const PropertyList<T>& other){
-    _hid = other.getId(true);
+    if (this != &other){
+      hid_t hid = other.getId(true);
+      close();
+      _hid = hid;
+    }
     return *this;
   };
 
   PropertyList& operator=(PropertyList&& other) noexcept{
-    _hid = other._hid;
-    other._hid = H5I_INVALID_HID;
+    if (this != &other){
+      close();
+      _hid = other._hid;
+      other._hid = H5I_INVALID_HID;
+    }
     return *this;
   }
 
@@ -99,12 +109,19 @@ public:
   }
 
   hid_t getId(const bool& increaseRefCount = false) const {
-    if (increaseRefCount)
+    // `H5P_DEFAULT` is not a real id and doesn't have reference counter
+    if (increaseRefCount && !isDefault())
       H5Iinc_ref(_hid);
 
     return _hid;
   }
 
+  /// \brief whether the object is backed by `H5P_DEFAULT`.
+  /// Such objects are cheap to create and copy but can't be modified
+  bool isDefault() const noexcept {
+    return _hid == H5P_DEFAULT;
+  }
+
   PropertyList() noexcept{
     initializeId();
   }
@@ -117,6 +134,26 @@ public:
 protected:
   PropertyList(const hid_t& hid) noexcept : _hid(hid) {}
 
+  /// \brief shared read-only instance of `P` backed by `H5P_DEFAULT`.
+  /// It is used as default argument so that a call doesn't have to
+  /// create and close a property list
+  template <class P>
+  static const P& defaultInstance() {
+    static const P props = [](){
+      P p;
+      p.close();
+      p._hid = H5P_DEFAULT;
+      return p;
+    }();
+    return props;
+  }
+
+  void close() noexcept {
+    if (_hid != H5P_DEFAULT && _hid != H5I_INVALID_HID) {
+      H5Pclose(_hid);
+    }
+  }
+
   void setExternalLinkPrefix(const std::string& prefix);
 
   std::vector<hsize_t> getChunk(int max_ndims);
@@ -132,6 +169,13 @@ public:
     setCreateIntermediateGroup(1);  // create intermediate groups ON by default
   }
 
+  /// \brief default instance (intermediate groups creation ON). Unlike
+  /// other defaults it can't be backed by `H5P_DEFAULT` so a new list is
+  /// created on every call: a shared one would outlive `H5close()`
+  static LinkCreateProps Default(){
+    return LinkCreateProps();
+  }
+
   void setCreateIntermediateGroup(unsigned val);
 };
 
@@ -139,6 +183,11 @@ class LinkAccessProps : public PropertyList<PropertyType::LINK_ACCESS> {
 public:
   LinkAccessProps(){}
 
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const LinkAccessProps& Default(){
+    return defaultInstance<LinkAccessProps>();
+  }
+
   void setExternalLinkPrefix(const std::string& prefix){
     PropertyList::setExternalLinkPrefix(prefix);
   }
@@ -147,22 +196,181 @@ public:
 class FileCreateProps : public PropertyList<PropertyType::FILE_CREATE> {
 public:
   FileCreateProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const FileCreateProps& Default(){
+    return defaultInstance<FileCreateProps>();
+  }
+
+#if H5_VERSION_GE(1, 10, 1)
+  /// \brief set file space handling strategy.
+  /// `H5F_FSPACE_STRATEGY_PAGE` (paged aggregation) allocates metadata
+  /// and raw data in fixed size pages (see `setFileSpacePageSize`) that may
+  /// be cached by page buffer (see `FileAccessProps::setPageBufferSize`)
+  /// \param strategy file space handling strategy
+  /// \param persist whether free-space should be tracked across file sessions
+  /// \param threshold smallest free-space section size to be tracked
+  void setFileSpaceStrategy(const H5F_fspace_strategy_t& strategy,
+                            const bool& persist = false,
+                            const hsize_t& threshold = 1);
+
+  void getFileSpaceStrategy(H5F_fspace_strategy_t& strategy,
+                            bool& persist,
+                            hsize_t& threshold);
+
+  H5F_fspace_strategy_t getFileSpaceStrategy();
+
+  /// \brief set file space page size in bytes (4 KiB by default)
+  /// used by paged aggregation
+  void setFileSpacePageSize(const hsize_t& size);
+
+  hsize_t getFileSpacePageSize();
+#endif
 };
 
 class FileAccessProps : public PropertyList<PropertyType::FILE_ACCESS> {
 public:
   FileAccessProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const FileAccessProps& Default(){
+    return defaultInstance<FileAccessProps>();
+  }
+
+#if H5_VERSION_GE(1, 10, 1)
+  /// \brief set page buffer size (disabled by default).
+  /// Page buffer caches pages of files created with paged aggregation
+  /// (see `FileCreateProps::setFileSpaceStrategy`), opening other files fails
+  /// \param size buffer size in bytes (multiple of file space page size)
+  /// \param minMetaPerc minimum percentage of the buffer reserved for metadata
+  /// \param minRawPerc minimum percentage of the buffer reserved for raw data
+  void setPageBufferSize(const size_t& size,
+                         const unsigned& minMetaPerc = 0,
+                         const unsigned& minRawPerc = 0);
+
+  void getPageBufferSize(size_t& size,
+                         unsigned& minMetaPerc,
+                         unsigned& minRawPerc);
+
+  size_t getPageBufferSize();
+#endif
+
+  /// \brief align any file object of at least `threshold` bytes
+  /// to a multiple of `alignment` bytes (i.e. file system block size)
+  void setAlignment(const hsize_t& threshold, const hsize_t& alignment);
+
+  void getAlignment(hsize_t& threshold, hsize_t& alignment);
+
+  /// \brief set minimum size of metadata block allocations (2 KiB by default).
+  /// Larger blocks keep metadata together and reduce the number of small I/O
+  void setMetaBlockSize(const hsize_t& size);
+
+  hsize_t getMetaBlockSize();
+
+  /// \brief set size of block reserved for small raw data (2 KiB by default)
+  void setSmallDataBlockSize(const hsize_t& size);
+
+  hsize_t getSmallDataBlockSize();
+
+  /// \brief set maximum size of data sieve buffer (64 KiB by default)
+  /// used for partial I/O on contiguous datasets
+  void setSieveBufSize(const size_t& size);
+
+  size_t getSieveBufSize();
+
+  /// \brief set the range of library versions used to create objects
+  /// (i.e. `H5F_LIBVER_LATEST` enables the most efficient file format)
+  void setLibverBounds(const H5F_libver_t& low, const H5F_libver_t& high);
+
+  void getLibverBounds(H5F_libver_t& low, H5F_libver_t& high);
+
+  /// \brief set initial metadata cache configuration.
+  /// Fields not covered by other `Mdc` setters may be tuned here
+  /// (`config.version` is set automatically)
+  void setMdcConfig(const H5AC_cache_config_t& config);
+
+  H5AC_cache_config_t getMdcConfig();
+
+  /// \brief set metadata cache size in bytes (2 MiB initial, 1 KiB - 32 MiB
+  /// by default). Files with many objects benefit from bigger cache
+  /// \param initSize initial cache size
+  /// \param minSize minimum size the cache may be shrunk to by auto-resize
+  /// \param maxSize maximum size the cache may be grown to by auto-resize
+  void setMdcSize(const size_t& initSize,
+                  const size_t& minSize,
+                  const size_t& maxSize);
+
+  void getMdcSize(size_t& initSize, size_t& minSize, size_t& maxSize);
+
+  /// \brief enable/disable metadata cache auto-resize (enabled by default).
+  /// When disabled the cache size stays at its initial size
+  void setMdcAutoResize(const bool& enable);
+
+  bool getMdcAutoResize();
+
+#if H5_VERSION_GE(1, 10, 1)
+  /// \brief write metadata cache image to the file on close
+  /// so that the next open loads the cache in a single read instead of
+  /// many small ones. The image is removed from the file once it is loaded
+  /// by a writer. The image is generated only for files of the latest format
+  /// (see `setLibverBounds`). Not compatible with SWMR and parallel HDF5
+  /// \param generateImage whether to write cache image on close
+  /// \param saveResizeStatus whether to save auto-resize status too
+  /// \param entryAgeout number of file open/close cycles an entry
+  /// stays in the image without being accessed (-1 - never aged out)
+  void setMdcImageConfig(const bool& generateImage,
+                         const bool& saveResizeStatus = false,
+                         const int& entryAgeout = H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE);
+
+  void getMdcImageConfig(bool& generateImage,
+                         bool& saveResizeStatus,
+                         int& entryAgeout);
+
+  bool getMdcImageGenerate();
+
+  /// \brief evict object metadata from the cache when the object is closed
+  /// (disabled by default). Limits memory used by files with many objects
+  /// that are visited once
+  void setEvictOnClose(const bool& evict);
+
+  bool getEvictOnClose();
+#endif
+
+#ifdef H5GT_PARALLEL
+  /// \brief perform metadata reads collectively: one rank reads and
+  /// broadcasts instead of every rank hitting the file system.
+  /// All ranks must then call metadata reading functions collectively
+  void setAllCollMetadataOps(const bool& enable);
+
+  bool getAllCollMetadataOps();
+
+  /// \brief write metadata collectively in a single MPI-IO call on
+  /// cache flush instead of independent writes from rank 0
+  void setCollMetadataWrite(const bool& enable);
+
+  bool getCollMetadataWrite();
+#endif
 };
 
 class GroupCreateProps : public PropertyList<PropertyType::GROUP_CREATE> {
 public:
   GroupCreateProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const GroupCreateProps& Default(){
+    return defaultInstance<GroupCreateProps>();
+  }
 };
 
 class GroupAccessProps : public PropertyList<PropertyType::GROUP_ACCESS> {
 public:
   GroupAccessProps(){}
 
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const GroupAccessProps& Default(){
+    return defaultInstance<GroupAccessProps>();
+  }
+
   void setExternalLinkPrefix(const std::string& prefix){
     PropertyList::setExternalLinkPrefix(prefix);
   }
@@ -172,6 +380,11 @@ class DataSetCreateProps : public PropertyList<PropertyType::DATASET_CREATE> {
 public:
   DataSetCreateProps(){}
 
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const DataSetCreateProps& Default(){
+    return defaultInstance<DataSetCreateProps>();
+  }
+
   static DataSetCreateProps FromId(const hid_t& id, const bool& increaseRefCount = false){
     hid_t prop_class_id = H5Pget_class(id);
 
@@ -213,6 +426,60 @@ public:
 
   void setDeflate(const unsigned& level);
 
+  /// \brief append filter to the filter pipeline (the filter must be
+  /// registered, see `registerFilter`)
+  /// \param id filter identifier
+  /// \param flags `H5Z_FLAG_MANDATORY` or `H5Z_FLAG_OPTIONAL` (the filter
+  /// is skipped for chunks it fails to encode)
+  /// \param cdValues auxiliary data of the filter
+  void setFilter(const H5Z_filter_t& id,
+                 const unsigned& flags = H5Z_FLAG_MANDATORY,
+                 const std::vector<unsigned>& cdValues = std::vector<unsigned>());
+
+  /// \brief append scale-offset filter (lossy for floats)
+  /// \param scaleType `H5Z_SO_FLOAT_DSCALE` (`scaleFactor` decimal digits
+  /// are kept) or `H5Z_SO_INT` (`scaleFactor` is the minimum number of bits,
+  /// `H5Z_SO_INT_MINBITS_DEFAULT` lets HDF5 compute it)
+  void setScaleOffset(const H5Z_SO_scale_type_t& scaleType,
+                      const int& scaleFactor);
+
+  /// \brief append n-bit filter that packs the significant bits of a type
+  /// with reduced precision (see `H5Tset_precision`)
+  void setNBit();
+
+  /// \brief append Fletcher32 checksum filter
+  void setFletcher32();
+
+  /// \brief remove filter from the pipeline (`H5Z_FILTER_ALL` removes all)
+  void removeFilter(const H5Z_filter_t& id);
+
+  /// \brief number of filters in the pipeline
+  size_t getFilterCount();
+
+  /// \brief filters in the order they are applied when writing
+  std::vector<FilterInfo> getFilters();
+
+  bool hasFilter(const H5Z_filter_t& id);
+
+  /// \brief set when storage space is allocated: `H5D_ALLOC_TIME_EARLY`
+  /// (on creation), `H5D_ALLOC_TIME_INCR` (chunk by chunk on write),
+  /// `H5D_ALLOC_TIME_LATE` (on first write) or `H5D_ALLOC_TIME_DEFAULT`
+  /// (late for contiguous, incremental for chunked datasets).
+  /// With MPI-IO driver HDF5 allocates unfiltered datasets early anyway
+  /// while filtered datasets (HDF5 >= 1.10.2) are allocated collectively
+  /// on write, so dataset creation and writes must be called by all ranks
+  void setAllocTime(const H5D_alloc_time_t& allocTime);
+
+  H5D_alloc_time_t getAllocTime();
+
+  /// \brief set when fill value is written: `H5D_FILL_TIME_IFSET`
+  /// (default, only if the fill value is set), `H5D_FILL_TIME_ALLOC`
+  /// or `H5D_FILL_TIME_NEVER`. The latter saves filling (and compressing)
+  /// chunks that are overwritten anyway
+  void setFillTime(const H5D_fill_time_t& fillTime);
+
+  H5D_fill_time_t getFillTime();
+
   void setChunk(const std::initializer_list<hsize_t>& items){
     std::vector<hsize_t> dims{items};
     setChunk(dims);
@@ -256,6 +523,11 @@ class DataSetAccessProps : public PropertyList<PropertyType::DATASET_ACCESS> {
 public:
   DataSetAccessProps(){}
 
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const DataSetAccessProps& Default(){
+    return defaultInstance<DataSetAccessProps>();
+  }
+
   static DataSetAccessProps FromId(const hid_t& id, const bool& increaseRefCount = false){
     hid_t prop_class_id = H5Pget_class(id);
 
@@ -290,21 +562,140 @@ public:
 class DataTypeCreateProps : public PropertyList<PropertyType::DATATYPE_CREATE> {
 public:
   DataTypeCreateProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const DataTypeCreateProps& Default(){
+    return defaultInstance<DataTypeCreateProps>();
+  }
 };
 
 class DataTypeAccessProps : public PropertyList<PropertyType::DATATYPE_ACCESS> {
 public:
   DataTypeAccessProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const DataTypeAccessProps& Default(){
+    return defaultInstance<DataTypeAccessProps>();
+  }
 };
 
 class DataTransferProps : public PropertyList<PropertyType::DATASET_XFER> {
 public:
   DataTransferProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const DataTransferProps& Default(){
+    return defaultInstance<DataTransferProps>();
+  }
+
+  static DataTransferProps FromId(const hid_t& id, const bool& increaseRefCount = false){
+    hid_t prop_class_id = H5Pget_class(id);
+
+    if (prop_class_id < 0){
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get property class");
+    }
+    if (H5Pequal(prop_class_id, H5P_DATASET_XFER) <= 0){
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Property id is of different class");
+    }
+    if (increaseRefCount)
+      H5Iinc_ref(id);
+
+    return DataTransferProps(id);
+  };
+
+  /// \brief set the size of type conversion and background buffers
+  /// (1 MiB by default). Bigger buffers reduce the number of passes
+  /// needed to read/write large or strided selections that require
+  /// type conversion
+  /// \param size buffer size in bytes
+  /// \param tconv preallocated type conversion buffer (at least `size` bytes)
+  /// or NULL to let HDF5 allocate it
+  /// \param bkg preallocated background buffer (at least `size` bytes)
+  /// or NULL to let HDF5 allocate it
+  void setBuffer(
+      const size_t& size, void* tconv = nullptr, void* bkg = nullptr);
+
+  /// \brief get the size of type conversion and background buffers
+  /// along with user provided buffers (NULL if they are allocated by HDF5)
+  void getBuffer(size_t& size, void*& tconv, void*& bkg);
+
+  size_t getBufferSize();
+
+  /// \brief set the number of I/O vectors to be collected at once
+  /// when performing I/O on hyperslab selections
+  void setHyperVectorSize(const size_t& size);
+
+  size_t getHyperVectorSize();
+
+  /// \brief enable/disable error detection (checksum verification) on read
+  void setEDCCheck(const bool& enable);
+
+  bool getEDCCheck();
+
+  /// \brief set data transform expression applied during I/O,
+  /// i.e. "(5/9.0)*(x-32)". The expression uses `x` as variable name
+  void setDataTransform(const std::string& expression);
+
+  /// \return data transform expression or empty string if it is not set
+  std::string getDataTransform();
+
+#ifdef H5GT_PARALLEL
+  /// \brief set MPI-IO transfer mode: `H5FD_MPIO_INDEPENDENT` (default)
+  /// or `H5FD_MPIO_COLLECTIVE`. Collective transfer lets MPI-IO aggregate
+  /// requests of all ranks into few large file accesses; every rank must
+  /// then take part in the read/write (possibly with empty selection)
+  void setMpioTransferMode(const H5FD_mpio_xfer_t& mode);
+
+  H5FD_mpio_xfer_t getMpioTransferMode();
+
+  /// \brief with collective transfer mode choose whether low-level I/O is
+  /// `H5FD_MPIO_COLLECTIVE_IO` (default) or `H5FD_MPIO_INDIVIDUAL_IO`
+  void setMpioCollectiveOpt(const H5FD_mpio_collective_opt_t& opt);
+
+  /// \brief choose how chunks are transferred collectively:
+  /// `H5FD_MPIO_CHUNK_ONE_IO` - all chunks in a single MPI-IO call,
+  /// `H5FD_MPIO_CHUNK_MULTI_IO` - chunk by chunk,
+  /// `H5FD_MPIO_CHUNK_DEFAULT` - decided by HDF5 (see `setMpioChunkOptNum`)
+  void setMpioChunkOpt(const H5FD_mpio_chunk_opt_t& opt);
+
+  /// \brief threshold of average number of chunks per rank above which
+  /// chunks are transferred in a single MPI-IO call
+  void setMpioChunkOptNum(const unsigned& numChunkPerProc);
+
+  /// \brief percentage of ranks accessing a chunk above which the chunk
+  /// is transferred collectively in multi-chunk mode (60 by default)
+  void setMpioChunkOptRatio(const unsigned& percentProcPerChunk);
+
+  /// \brief I/O mode actually used by the last read/write performed
+  /// with these properties (i.e. `H5D_MPIO_NO_COLLECTIVE` when HDF5
+  /// fell back to independent I/O)
+  H5D_mpio_actual_io_mode_t getMpioActualIoMode();
+
+  /// \brief chunk optimization actually used by the last read/write
+  /// performed with these properties
+  H5D_mpio_actual_chunk_opt_mode_t getMpioActualChunkOptMode();
+
+  /// \brief reasons why the last read/write performed with these
+  /// properties was not collective: bit field of
+  /// `H5D_mpio_no_collective_cause_t` (`H5D_MPIO_COLLECTIVE` if it was)
+  /// \param localCause cause on this rank
+  /// \param globalCause causes on all ranks
+  void getMpioNoCollectiveCause(uint32_t& localCause, uint32_t& globalCause);
+#endif
+
+  using PropertyList::PropertyList;
 };
 
 class ObjectCopyProps : public PropertyList<PropertyType::OBJECT_COPY> {
 public:
   ObjectCopyProps(){}
+
+  /// \brief shared read-only instance backed by `H5P_DEFAULT`
+  static const ObjectCopyProps& Default(){
+    return defaultInstance<ObjectCopyProps>();
+  }
 };
 
 }  // namespace h5gt
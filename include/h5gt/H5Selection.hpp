@@ -53,8 +53,19 @@ private:
             const DataSpace& file_space,
             const DataSet& set);
 
-  DataSpace _mem_space, _file_space;
+  // row/column `i` of `memspace` along `axis` is
+  // row/column `perm[i]` of `io_memspace` used for I/O
+  Selection(const DataSpace& memspace,
+            const DataSpace& file_space,
+            const DataSet& set,
+            const DataSpace& io_memspace,
+            const std::vector<size_t>& perm,
+            size_t axis);
+
+  DataSpace _mem_space, _file_space, _io_mem_space;
   DataSet _set;
+  std::vector<size_t> _perm;
+  size_t _perm_axis = 0;
 
   template <typename Derivate> friend class ::h5gt::SliceTraits;
   // absolute namespace naming due to GCC bug 52625
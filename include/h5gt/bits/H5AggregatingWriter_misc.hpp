@@ -0,0 +1,392 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5AGGREGATINGWRITER_MISC_HPP
+#define H5AGGREGATINGWRITER_MISC_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include <H5Dpublic.h>
+#include <H5Spublic.h>
+
+namespace h5gt {
+
+namespace details {
+
+// copy row-major box of `count` elements to a row-major array of `dims`
+// at `offset`, `mask` marks copied elements
+template <typename T>
+inline void copy_box_to(const T* src, T* dst, const size_t* offset,
+                        const size_t* count, const std::vector<size_t>& dims,
+                        std::vector<bool>& mask) {
+  const size_t ndims = dims.size();
+  const size_t row = count[ndims - 1];
+  size_t nRows = 1;
+  for (size_t d = 0; d + 1 < ndims; d++)
+    nRows *= count[d];
+
+  std::vector<size_t> index(ndims, 0);
+  for (size_t r = 0; r < nRows; r++) {
+    size_t pos = 0;
+    for (size_t d = 0; d < ndims; d++)
+      pos = pos * dims[d] + offset[d] + index[d];
+    std::memcpy(dst + pos, src + r * row, row * sizeof(T));
+    std::fill(mask.begin() + pos, mask.begin() + pos + row, true);
+
+    for (size_t d = ndims - 1; d-- > 0;) {
+      if (++index[d] < count[d])
+        break;
+      index[d] = 0;
+    }
+  }
+}
+
+}  // namespace details
+
+template <typename T>
+inline AggregatingWriter<T>::AggregatingWriter(
+    const DataSet& dset, MPI_Comm comm, int nAggregators,
+    size_t alignment, const DataTransferProps& xferProps)
+  : _dset(dset)
+  , _xfer(xferProps)
+  , _comm(comm)
+  , _alignment(std::max<size_t>(alignment, 1)) {
+  MPI_Comm_rank(_comm, &_rank);
+  MPI_Comm_size(_comm, &_size);
+
+  if (_xfer.isDefault()) {
+    _xfer = DataTransferProps();
+    _xfer.setMpioTransferMode(H5FD_MPIO_COLLECTIVE);
+  }
+
+  // one aggregator per node: count node leaders
+  if (nAggregators <= 0) {
+    MPI_Comm node;
+    int nodeRank;
+    MPI_Comm_split_type(_comm, MPI_COMM_TYPE_SHARED, _rank, MPI_INFO_NULL, &node);
+    MPI_Comm_rank(node, &nodeRank);
+    MPI_Comm_free(&node);
+    int leader = nodeRank == 0 ? 1 : 0;
+    MPI_Allreduce(&leader, &nAggregators, 1, MPI_INT, MPI_SUM, _comm);
+  }
+  nAggregators = std::min(std::max(nAggregators, 1), _size);
+
+  // ranks are usually placed by blocks: spread aggregators among nodes
+  for (int i = 0; i < nAggregators; i++) {
+    _aggregators.push_back(int((long long)i * _size / nAggregators));
+    if (_aggregators.back() == _rank)
+      _aggregatorIndex = i;
+  }
+
+  _updateDomains();
+}
+
+template <typename T>
+inline void AggregatingWriter<T>::write(
+    const T* buffer,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count) {
+  if (offset.size() != _dims.size() || count.size() != _dims.size()) {
+    throw DataSetException("Box rank differs from dataset rank");
+  }
+
+  size_t n = 1;
+  for (size_t d = 0; d < _dims.size(); d++) {
+    if (offset[d] + count[d] > _dims[d]) {
+      throw DataSetException("Box is out of dataset extent");
+    }
+    n *= count[d];
+  }
+  if (n == 0)
+    return;
+
+  _boxes.insert(_boxes.end(), offset.begin(), offset.end());
+  _boxes.insert(_boxes.end(), count.begin(), count.end());
+  _buffer.insert(_buffer.end(), buffer, buffer + n);
+}
+
+template <typename T>
+inline void AggregatingWriter<T>::write(
+    const std::vector<T>& buffer,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count) {
+  size_t n = 1;
+  for (const auto& c : count)
+    n *= c;
+  if (buffer.size() != n) {
+    throw DataSetException("Buffer size differs from box size");
+  }
+  write(buffer.data(), offset, count);
+}
+
+template <typename T>
+inline void AggregatingWriter<T>::flush() {
+  const size_t ndims = _dims.size();
+  const size_t box_size = 2 * ndims;
+
+  // phase 1: split boxes at domain boundaries and send pieces to aggregators
+  std::vector<unsigned long long> send_boxes;
+  std::vector<int> send_dest;
+  std::vector<size_t> send_src;  // element offset of the piece in `_buffer`
+  // number of box values and bytes per rank
+  std::vector<unsigned long long> meta(2 * _size, 0);
+
+  size_t src = 0;
+  for (size_t b = 0; b < _boxes.size(); b += box_size) {
+    const unsigned long long* box = _boxes.data() + b;
+    size_t row = 1;
+    for (size_t d = 1; d < ndims; d++)
+      row *= box[ndims + d];
+
+    const size_t first = box[0], last = box[0] + box[ndims];
+    for (size_t r = first; r < last;) {
+      const size_t a = _domainOf(r);
+      const size_t stop = std::min<size_t>(last, _domains[a + 1]);
+      const int dest = _aggregators[a];
+
+      send_boxes.insert(send_boxes.end(), box, box + box_size);
+      send_boxes[send_boxes.size() - box_size] = r;
+      send_boxes[send_boxes.size() - ndims] = stop - r;
+      send_dest.push_back(dest);
+      send_src.push_back(src + (r - first) * row);
+
+      meta[2 * dest] += box_size;
+      meta[2 * dest + 1] += (unsigned long long)(stop - r) * row * sizeof(T);
+      r = stop;
+    }
+    src += (last - first) * row;
+  }
+
+  std::vector<unsigned long long> recv_meta(2 * _size);
+  MPI_Alltoall(meta.data(), 2, MPI_UNSIGNED_LONG_LONG,
+               recv_meta.data(), 2, MPI_UNSIGNED_LONG_LONG, _comm);
+
+  // counts and displacements of MPI_Alltoallv are `int`: all ranks agree
+  // on the error before the exchange so none of them is left blocked in it
+  unsigned long long totals[4] = {0, 0, 0, 0};
+  for (int p = 0; p < _size; p++) {
+    for (int i = 0; i < 2; i++) {
+      totals[i] += meta[2 * p + i];
+      totals[2 + i] += recv_meta[2 * p + i];
+    }
+  }
+  int overflow = *std::max_element(totals, totals + 4) > (unsigned long long)INT_MAX;
+  MPI_Allreduce(MPI_IN_PLACE, &overflow, 1, MPI_INT, MPI_LOR, _comm);
+  if (overflow) {
+    throw DataSetException("Too much data buffered for an aggregator, flush more often");
+  }
+
+  std::vector<int> send_count(_size), send_displ(_size), recv_count(_size), recv_displ(_size);
+  std::vector<int> send_bytes(_size), send_bytes_displ(_size), recv_bytes(_size), recv_bytes_displ(_size);
+  int send_total = 0, send_bytes_total = 0, recv_total = 0, recv_bytes_total = 0;
+  for (int p = 0; p < _size; p++) {
+    send_count[p] = int(meta[2 * p]);
+    send_bytes[p] = int(meta[2 * p + 1]);
+    recv_count[p] = int(recv_meta[2 * p]);
+    recv_bytes[p] = int(recv_meta[2 * p + 1]);
+    send_displ[p] = send_total;
+    send_bytes_displ[p] = send_bytes_total;
+    recv_displ[p] = recv_total;
+    recv_bytes_displ[p] = recv_bytes_total;
+    send_total += send_count[p];
+    send_bytes_total += send_bytes[p];
+    recv_total += recv_count[p];
+    recv_bytes_total += recv_bytes[p];
+  }
+
+  // pack pieces by destination keeping their order
+  std::vector<unsigned long long> boxes_out(send_total);
+  std::vector<char> data_out(send_bytes_total);
+  {
+    std::vector<int> box_pos(send_displ), byte_pos(send_bytes_displ);
+    for (size_t i = 0; i < send_dest.size(); i++) {
+      const int dest = send_dest[i];
+      const unsigned long long* box = send_boxes.data() + i * box_size;
+      size_t n = 1;
+      for (size_t d = 0; d < ndims; d++)
+        n *= box[ndims + d];
+      std::copy(box, box + box_size, boxes_out.begin() + box_pos[dest]);
+      std::memcpy(data_out.data() + byte_pos[dest], _buffer.data() + send_src[i], n * sizeof(T));
+      box_pos[dest] += int(box_size);
+      byte_pos[dest] += int(n * sizeof(T));
+    }
+  }
+  _boxes.clear();
+  _buffer.clear();
+
+  std::vector<unsigned long long> boxes_in(recv_total);
+  std::vector<char> data_in(recv_bytes_total);
+  MPI_Alltoallv(boxes_out.data(), send_count.data(), send_displ.data(), MPI_UNSIGNED_LONG_LONG,
+                boxes_in.data(), recv_count.data(), recv_displ.data(), MPI_UNSIGNED_LONG_LONG,
+                _comm);
+  MPI_Alltoallv(data_out.data(), send_bytes.data(), send_bytes_displ.data(), MPI_BYTE,
+                data_in.data(), recv_bytes.data(), recv_bytes_displ.data(), MPI_BYTE,
+                _comm);
+  boxes_out = std::vector<unsigned long long>();
+  data_out = std::vector<char>();
+
+  // phase 2: aggregators assemble the bounding box of received pieces
+  // (pieces arrive ordered by source rank) and write it collectively
+  std::vector<size_t> lo(ndims, 0), hi(ndims, 0);
+  const size_t nBoxes = boxes_in.size() / std::max<size_t>(box_size, 1);
+  for (size_t b = 0; b < nBoxes; b++) {
+    const unsigned long long* box = boxes_in.data() + b * box_size;
+    for (size_t d = 0; d < ndims; d++) {
+      lo[d] = b == 0 ? box[d] : std::min<size_t>(lo[d], box[d]);
+      hi[d] = b == 0 ? box[d] + box[ndims + d] :
+                       std::max<size_t>(hi[d], box[d] + box[ndims + d]);
+    }
+  }
+
+  std::vector<size_t> bbox(ndims);
+  size_t bbox_size = nBoxes > 0 ? 1 : 0;
+  for (size_t d = 0; d < ndims; d++) {
+    bbox[d] = hi[d] - lo[d];
+    bbox_size *= bbox[d];
+  }
+
+  std::vector<T> assembled(bbox_size);
+  std::vector<bool> covered(bbox_size, false);
+  {
+    std::vector<size_t> offset(ndims), count(ndims);
+    const char* data = data_in.data();
+    for (size_t b = 0; b < nBoxes; b++) {
+      const unsigned long long* box = boxes_in.data() + b * box_size;
+      size_t n = 1;
+      for (size_t d = 0; d < ndims; d++) {
+        offset[d] = box[d] - lo[d];
+        count[d] = box[ndims + d];
+        n *= count[d];
+      }
+      details::copy_box_to(reinterpret_cast<const T*>(data), assembled.data(),
+                           offset.data(), count.data(), bbox, covered);
+      data += n * sizeof(T);
+    }
+  }
+  data_in = std::vector<char>();
+
+  DataSpace file_space = _dset.getSpace();
+  DataSpace mem_space(bbox_size > 0 ? bbox : std::vector<size_t>{1});
+  hid_t file_id = file_space.getId(false);
+  hid_t mem_id = mem_space.getId(false);
+  herr_t status = 0;
+  if (bbox_size == 0) {
+    status = std::min(H5Sselect_none(file_id), H5Sselect_none(mem_id));
+  } else if (std::find(covered.begin(), covered.end(), false) == covered.end()) {
+    // pieces tile the bounding box: single hyperslab
+    std::vector<hsize_t> start(lo.begin(), lo.end()), extent(bbox.begin(), bbox.end());
+    status = H5Sselect_hyperslab(file_id, H5S_SELECT_SET, start.data(),
+                                 nullptr, extent.data(), nullptr);
+  } else {
+    status = std::min(H5Sselect_none(file_id), H5Sselect_none(mem_id));
+    std::vector<hsize_t> file_start(ndims), mem_start(ndims), extent(ndims);
+    for (size_t b = 0; b < nBoxes && status >= 0; b++) {
+      const unsigned long long* box = boxes_in.data() + b * box_size;
+      for (size_t d = 0; d < ndims; d++) {
+        file_start[d] = box[d];
+        mem_start[d] = box[d] - lo[d];
+        extent[d] = box[ndims + d];
+      }
+      status = std::min(
+            H5Sselect_hyperslab(file_id, H5S_SELECT_OR, file_start.data(),
+                                nullptr, extent.data(), nullptr),
+            H5Sselect_hyperslab(mem_id, H5S_SELECT_OR, mem_start.data(),
+                                nullptr, extent.data(), nullptr));
+    }
+  }
+  if (status < 0) {
+    HDF5ErrMapper::ToException<DataSetException>(
+          "Unable to select aggregated boxes");
+  }
+
+  const DataType mem_datatype = create_and_check_datatype<T>();
+  if (H5Dwrite(_dset.getId(false), mem_datatype.getId(false), mem_id, file_id,
+               _xfer.getId(false), assembled.data()) < 0) {
+    HDF5ErrMapper::ToException<DataSetException>(
+          "Unable to write aggregated boxes");
+  }
+
+  _updateDomains();
+}
+
+template <typename T>
+inline size_t AggregatingWriter<T>::getBufferedSize() const noexcept {
+  return _buffer.size();
+}
+
+template <typename T>
+inline const std::vector<int>& AggregatingWriter<T>::getAggregators() const noexcept {
+  return _aggregators;
+}
+
+template <typename T>
+inline bool AggregatingWriter<T>::isAggregator() const noexcept {
+  return _aggregatorIndex >= 0;
+}
+
+template <typename T>
+inline const std::vector<size_t>& AggregatingWriter<T>::getDomains() const noexcept {
+  return _domains;
+}
+
+template <typename T>
+inline const DataSet& AggregatingWriter<T>::getDataSet() const noexcept {
+  return _dset;
+}
+
+template <typename T>
+inline void AggregatingWriter<T>::_updateDomains() {
+  _dims = _dset.getDimensions();
+  if (_dims.empty()) {
+    throw DataSetException("AggregatingWriter requires non scalar dataset");
+  }
+
+  const size_t nRows = _dims[0];
+  size_t row_bytes = sizeof(T);
+  for (size_t d = 1; d < _dims.size(); d++)
+    row_bytes *= _dims[d];
+
+  DataSetCreateProps props = _dset.getCreateProps();
+  const bool chunked = props.isChunked();
+  size_t chunk_rows = 1;
+  haddr_t base = 0;
+  if (chunked) {
+    chunk_rows = std::max<size_t>(1, props.getChunk(int(_dims.size()))[0]);
+  } else {
+    base = H5Dget_offset(_dset.getId(false));
+    if (base == HADDR_UNDEF)
+      base = 0;
+  }
+
+  const size_t nAgg = _aggregators.size();
+  _domains.assign(nAgg + 1, nRows);
+  _domains[0] = 0;
+  for (size_t i = 1; i < nAgg; i++) {
+    size_t row = size_t((unsigned long long)nRows * i / nAgg);
+    if (chunked) {
+      row = (row + chunk_rows / 2) / chunk_rows * chunk_rows;
+    } else if (row_bytes > 0) {
+      // first row starting at or after the aligned file address
+      unsigned long long addr = base + (unsigned long long)row * row_bytes;
+      addr = (addr + _alignment - 1) / _alignment * _alignment;
+      row = size_t((addr - base + row_bytes - 1) / row_bytes);
+    }
+    _domains[i] = std::min(std::max(row, _domains[i - 1]), nRows);
+  }
+}
+
+template <typename T>
+inline size_t AggregatingWriter<T>::_domainOf(size_t row) const {
+  auto it = std::upper_bound(_domains.begin(), _domains.end(), row);
+  size_t a = size_t(it - _domains.begin());
+  return std::min(a == 0 ? 0 : a - 1, _aggregators.size() - 1);
+}
+
+}  // namespace h5gt
+
+#endif // H5AGGREGATINGWRITER_MISC_HPP
@@ -0,0 +1,234 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5APPENDABLEDATASET_MISC_HPP
+#define H5APPENDABLEDATASET_MISC_HPP
+
+#include <algorithm>
+#include <cstring>
+
+#include <H5Ppublic.h>
+
+namespace h5gt {
+
+template <typename T>
+template <typename Derivate>
+inline AppendableDataSet<T> AppendableDataSet<T>::create(
+    NodeTraits<Derivate>& node,
+    const std::string& dataset_name,
+    const std::vector<size_t>& recordDims,
+    size_t axis,
+    size_t chunkRecords,
+    const DataSetCreateProps& dsetCreateProps,
+    const LinkCreateProps& linkCreateProps) {
+  if (axis > recordDims.size()) {
+    throw DataSetException("Append axis is out of range");
+  }
+
+  std::vector<size_t> dims(recordDims);
+  dims.insert(dims.begin() + axis, 0);
+  std::vector<size_t> maxdims(dims);
+  maxdims[axis] = DataSpace::UNLIMITED;
+
+  // don't modify user's property list
+  DataSetCreateProps props = dsetCreateProps.isDefault() ?
+        DataSetCreateProps() :
+        DataSetCreateProps::FromId(H5Pcopy(dsetCreateProps.getId(false)), false);
+  if (!props.isChunked()) {
+    size_t record_size = 1;
+    for (const auto& d : recordDims)
+      record_size *= d;
+    if (chunkRecords == 0)
+      chunkRecords = std::max<size_t>(
+            1, (size_t(64) << 10) / std::max<size_t>(1, record_size * sizeof(T)));
+
+    std::vector<hsize_t> chunk(dims.begin(), dims.end());
+    for (auto& c : chunk)
+      c = std::max<hsize_t>(c, 1);
+    chunk[axis] = chunkRecords;
+    props.setChunk(chunk);
+  }
+
+  DataSet dset = node.template createDataSet<T>(
+        dataset_name, DataSpace(dims, maxdims), linkCreateProps, props);
+  return AppendableDataSet(dset, axis);
+}
+
+template <typename T>
+inline AppendableDataSet<T>::AppendableDataSet(
+    const DataSet& dset, size_t axis, size_t bufferRecords)
+  : _dset(dset)
+  , _dims(dset.getDimensions())
+  , _axis(axis) {
+  if (axis >= _dims.size()) {
+    throw DataSetException("Append axis is out of range");
+  }
+  if (dset.getSpace().getMaxDimensions()[axis] != DataSpace::UNLIMITED) {
+    throw DataSetException("DataSet must be unlimited along append axis");
+  }
+
+  for (size_t d = 0; d < axis; d++)
+    _outer *= _dims[d];
+  for (size_t d = axis + 1; d < _dims.size(); d++)
+    _inner *= _dims[d];
+
+  _chunk = std::max<size_t>(
+        1, _dset.getCreateProps().getChunk(int(_dims.size()))[axis]);
+
+  if (bufferRecords == 0) {
+    const size_t record_bytes = std::max<size_t>(1, getRecordSize() * sizeof(T));
+    bufferRecords = (size_t(1) << 20) / record_bytes / _chunk * _chunk;
+    bufferRecords = std::max(bufferRecords, _chunk);
+  }
+  _capacity = bufferRecords;
+  _written = _dims[axis];
+  _updateFlushTarget();
+}
+
+template <typename T>
+inline AppendableDataSet<T>::~AppendableDataSet() {
+  if (!_dset.isValid())
+    return;
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::append(const T& value) {
+  if (getRecordSize() != 1) {
+    throw DataSetException("Record size is not 1");
+  }
+  append(&value, 1);
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::append(const std::vector<T>& records) {
+  const size_t record_size = getRecordSize();
+  if (record_size == 0 || records.size() % record_size != 0) {
+    throw DataSetException("Number of elements isn't a multiple of record size");
+  }
+  append(records.data(), records.size() / record_size);
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::append(const T* records, size_t nRecords) {
+  const size_t record_size = getRecordSize();
+  while (nRecords > 0) {
+    const size_t buffered = _buffer.size() / std::max<size_t>(1, record_size);
+    const size_t space = _target - _written - buffered;
+
+    // whole block is available: write it without copying
+    if (buffered == 0 && nRecords >= space) {
+      _write(records, space);
+    } else {
+      const size_t n = std::min(nRecords, space);
+      _buffer.insert(_buffer.end(), records, records + n * record_size);
+      if (n < space)
+        return;
+      flush();
+    }
+    records += space * record_size;
+    nRecords -= space;
+  }
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::flush() {
+  if (_buffer.empty())
+    return;
+  _write(_buffer.data(), _buffer.size() / getRecordSize());
+  _buffer.clear();
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::close() {
+  flush();
+  if (_dims[_axis] != _written)
+    _resize(_written);
+}
+
+template <typename T>
+inline size_t AppendableDataSet<T>::size() const noexcept {
+  const size_t record_size = getRecordSize();
+  return _written + (record_size == 0 ? 0 : _buffer.size() / record_size);
+}
+
+template <typename T>
+inline size_t AppendableDataSet<T>::getRecordSize() const noexcept {
+  return _outer * _inner;
+}
+
+template <typename T>
+inline size_t AppendableDataSet<T>::getAxis() const noexcept {
+  return _axis;
+}
+
+template <typename T>
+inline const DataSet& AppendableDataSet<T>::getDataSet() const noexcept {
+  return _dset;
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::_write(const T* records, size_t nRecords) {
+  if (nRecords == 0)
+    return;
+
+  _reserve(_written + nRecords);
+
+  std::vector<size_t> offset(_dims.size(), 0), count(_dims);
+  offset[_axis] = _written;
+  count[_axis] = nRecords;
+
+  // records go one after another while the block is row-major:
+  // interleave records unless appending along the first axis
+  const T* data = records;
+  if (_outer > 1 && getRecordSize() > 0) {
+    _scratch.resize(nRecords * getRecordSize());
+    for (size_t r = 0; r < nRecords; r++)
+      for (size_t o = 0; o < _outer; o++)
+        std::memcpy(_scratch.data() + (o * nRecords + r) * _inner,
+                    records + (r * _outer + o) * _inner,
+                    _inner * sizeof(T));
+    data = _scratch.data();
+  }
+
+  _dset.select(offset, count).write_raw(data);
+  _written += nRecords;
+  _updateFlushTarget();
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::_reserve(size_t nRecords) {
+  if (nRecords <= _dims[_axis])
+    return;
+
+  // grow geometrically and keep the extent chunk aligned
+  size_t extent = std::max(nRecords, 2 * _dims[_axis]);
+  extent = (extent + _chunk - 1) / _chunk * _chunk;
+  _resize(extent);
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::_resize(size_t nRecords) {
+  std::vector<size_t> dims(_dims);
+  dims[_axis] = nRecords;
+  _dset.resize(dims);
+  _dims = dims;
+}
+
+template <typename T>
+inline void AppendableDataSet<T>::_updateFlushTarget() noexcept {
+  // the first block may be shorter so that next blocks are chunk aligned
+  _target = (_written + _capacity) / _chunk * _chunk;
+  if (_target <= _written)
+    _target = _written + _capacity;
+}
+
+}  // namespace h5gt
+
+#endif // H5APPENDABLEDATASET_MISC_HPP
@@ -0,0 +1,532 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5CHUNK_MISC_HPP
+#define H5CHUNK_MISC_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <H5Fpublic.h>
+#include <H5Ppublic.h>
+#include <H5Zpublic.h>
+#include <zlib.h>
+
+#include "../H5Filter.hpp"
+#include "../H5Utility.hpp"
+
+namespace h5gt {
+
+namespace details {
+
+// number of worker threads: 0 means number of hardware threads
+inline size_t get_num_threads(size_t nThreads) noexcept {
+  if (nThreads != 0)
+    return nThreads;
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// whether data transform expression is set (raw chunk I/O would bypass it)
+inline bool has_data_transform(hid_t dxpl) {
+  if (dxpl == H5P_DEFAULT)
+    return false;
+  // HDF5 raises an error if the expression has not been set
+  SilenceHDF5 silencer;
+  return H5Pget_data_transform(dxpl, NULL, 0) > 0;
+}
+
+// whether the file of the object is opened with MPI-IO driver: direct
+// chunk I/O is independent and would break collective transfer
+inline bool is_mpio_file(hid_t obj) {
+#ifdef H5GT_PARALLEL
+  hid_t file = H5Iget_file_id(obj);
+  if (file < 0)
+    return false;
+  hid_t fapl = H5Fget_access_plist(file);
+  bool mpio = fapl >= 0 && H5Pget_driver(fapl) == H5FD_MPIO;
+  if (fapl >= 0)
+    H5Pclose(fapl);
+  H5Fclose(file);
+  return mpio;
+#else
+  (void)obj;
+  return false;
+#endif
+}
+
+// chunk filled with the fill value of dataset (zeros if it is undefined)
+inline std::vector<char> get_fill_chunk(hid_t dcpl, hid_t mem_type,
+                                        size_t elem_size, size_t chunk_bytes) {
+  std::vector<char> fill(chunk_bytes, 0);
+  H5D_fill_value_t fill_status;
+  if (chunk_bytes >= elem_size &&
+      H5Pfill_value_defined(dcpl, &fill_status) >= 0 &&
+      fill_status != H5D_FILL_VALUE_UNDEFINED &&
+      H5Pget_fill_value(dcpl, mem_type, fill.data()) >= 0) {
+    for (size_t i = elem_size; i < chunk_bytes; i += elem_size)
+      std::memcpy(fill.data() + i, fill.data(), elem_size);
+  }
+  return fill;
+}
+
+///
+/// \brief Filter pipeline of a chunked dataset applied outside of HDF5.
+///
+/// Only shuffle, deflate and h5gt size preserving filters (bit shuffle and
+/// delta) are supported. Encoded chunks
+/// are identical to those produced by HDF5 itself so they may be
+/// written directly with `H5Dwrite_chunk`
+///
+class ChunkPipeline {
+public:
+  ///
+  /// \brief read filters from dataset creation property list
+  /// \return false if the pipeline contains unsupported filters
+  bool init(hid_t dcpl, size_t elem_size) {
+    _elem_size = elem_size;
+    _filters.clear();
+
+    int nfilters = H5Pget_nfilters(dcpl);
+    if (nfilters < 0)
+      return false;
+
+    for (unsigned idx = 0; idx < unsigned(nfilters); idx++) {
+      Filter filter;
+      size_t cd_nelmts = 8;
+      unsigned cd_values[8];
+      char name[64] = "";
+      unsigned filter_config;
+      filter.id = H5Pget_filter2(dcpl, idx, &filter.flags, &cd_nelmts,
+                                 cd_values, sizeof(name), name, &filter_config);
+      if (filter.id != H5Z_FILTER_SHUFFLE && filter.id != H5Z_FILTER_DEFLATE &&
+          !isCodec<BitShuffleFilter>(filter.id, name, cd_nelmts, cd_values) &&
+          !isCodec<DeltaFilter>(filter.id, name, cd_nelmts, cd_values))
+        return false;
+
+      filter.level = (filter.id == H5Z_FILTER_DEFLATE && cd_nelmts > 0) ?
+            cd_values[0] : 0;
+      _filters.push_back(filter);
+    }
+    return true;
+  }
+
+  ///
+  /// \brief apply filters to `chunk` (in place)
+  /// \return filter mask: bit `i` is set if optional filter `i` failed
+  /// and was skipped (same as HDF5 does)
+  unsigned encode(std::vector<char>& chunk) const {
+    unsigned filter_mask = 0;
+    std::vector<char> scratch;
+    for (size_t idx = 0; idx < _filters.size(); idx++) {
+      const Filter& filter = _filters[idx];
+      bool ok = true;
+      if (filter.id != H5Z_FILTER_DEFLATE) {
+        scratch.resize(chunk.size());
+        transform(filter.id, chunk.data(), scratch.data(), chunk.size(), false);
+      } else {
+        // the output buffer has the same size as in `H5Z__filter_deflate`
+        // so the filter fails (and optional filter is skipped) exactly when
+        // it fails in HDF5
+        uLongf dst_nbytes = uLongf(std::ceil(double(chunk.size()) * 1.001)) + 12;
+        scratch.resize(dst_nbytes);
+        ok = compress2(reinterpret_cast<Bytef*>(scratch.data()), &dst_nbytes,
+                       reinterpret_cast<const Bytef*>(chunk.data()),
+                       uLong(chunk.size()), int(filter.level)) == Z_OK;
+        scratch.resize(dst_nbytes);
+      }
+
+      if (ok) {
+        chunk.swap(scratch);
+      } else if (filter.flags & H5Z_FLAG_OPTIONAL) {
+        filter_mask |= 1u << idx;
+      } else {
+        throw DataSetException("Unable to apply deflate filter to chunk");
+      }
+    }
+    return filter_mask;
+  }
+
+  ///
+  /// \brief undo filters applied to `chunk` (in place)
+  /// \param chunk_bytes size of decoded chunk
+  /// \param filter_mask filters to skip (as returned by `H5Dread_chunk`)
+  void decode(std::vector<char>& chunk, size_t chunk_bytes,
+              unsigned filter_mask) const {
+    std::vector<char> scratch;
+    for (size_t idx = _filters.size(); idx-- > 0;) {
+      if (filter_mask & (1u << idx))
+        continue;
+
+      const Filter& filter = _filters[idx];
+      if (filter.id != H5Z_FILTER_DEFLATE) {
+        scratch.resize(chunk.size());
+        transform(filter.id, chunk.data(), scratch.data(), chunk.size(), true);
+      } else {
+        uLongf dst_nbytes = uLongf(chunk_bytes);
+        scratch.resize(chunk_bytes);
+        if (uncompress(reinterpret_cast<Bytef*>(scratch.data()), &dst_nbytes,
+                       reinterpret_cast<const Bytef*>(chunk.data()),
+                       uLong(chunk.size())) != Z_OK ||
+            dst_nbytes != chunk_bytes) {
+          throw DataSetException("Unable to inflate chunk");
+        }
+      }
+      chunk.swap(scratch);
+    }
+
+    if (chunk.size() != chunk_bytes)
+      throw DataSetException("Decoded chunk has unexpected size");
+  }
+
+private:
+  // filter with the id of h5gt `Codec` is applied by h5gt only if it was
+  // written by h5gt: other tools may use ids from the testing range too
+  template <typename Codec>
+  static bool isCodec(H5Z_filter_t id, const char* name,
+                      size_t cd_nelmts, const unsigned cd_values[]) {
+    return id == Codec::id && std::strcmp(name, Codec::name()) == 0 &&
+        details::has_codec_signature(cd_nelmts, cd_values);
+  }
+
+  // size preserving filters
+  void transform(H5Z_filter_t id, const char* src, char* dst,
+                 size_t nbytes, bool reverse) const {
+    switch (id) {
+    case ByteShuffleFilter::id:
+      reverse ? ByteShuffleFilter::decode(src, dst, nbytes, _elem_size) :
+                ByteShuffleFilter::encode(src, dst, nbytes, _elem_size);
+      break;
+    case BitShuffleFilter::id:
+      reverse ? BitShuffleFilter::decode(src, dst, nbytes, _elem_size) :
+                BitShuffleFilter::encode(src, dst, nbytes, _elem_size);
+      break;
+    default:
+      reverse ? DeltaFilter::decode(src, dst, nbytes, _elem_size) :
+                DeltaFilter::encode(src, dst, nbytes, _elem_size);
+    }
+  }
+
+  struct Filter {
+    H5Z_filter_t id;
+    unsigned flags;
+    unsigned level;
+  };
+
+  std::vector<Filter> _filters;
+  size_t _elem_size = 0;
+};
+
+///
+/// \brief Geometry of chunks covering a box `[offset, offset + count)`
+///
+struct ChunkBox {
+  std::vector<size_t> offset;
+  std::vector<size_t> count;
+  std::vector<size_t> chunk_dims;
+  std::vector<size_t> nchunks;  // along each dimension
+  std::vector<size_t> grid_offset;  // offset of the first chunk
+
+  ChunkBox(const std::vector<size_t>& box_offset,
+           const std::vector<size_t>& box_count,
+           const std::vector<size_t>& cdims)
+    : offset(box_offset)
+    , count(box_count)
+    , chunk_dims(cdims)
+    , nchunks(cdims.size())
+    , grid_offset(cdims.size()) {
+    // the box may start in the middle of a chunk
+    for (size_t d = 0; d < cdims.size(); d++) {
+      grid_offset[d] = offset[d] / cdims[d] * cdims[d];
+      nchunks[d] = count[d] == 0 ? 0 :
+          (offset[d] + count[d] - 1) / cdims[d] - offset[d] / cdims[d] + 1;
+    }
+  }
+
+  size_t size() const noexcept {
+    size_t n = 1;
+    for (const auto& c : nchunks)
+      n *= c;
+    return n;
+  }
+
+  size_t chunkBytes(size_t elem_size) const noexcept {
+    size_t n = elem_size;
+    for (const auto& c : chunk_dims)
+      n *= c;
+    return n;
+  }
+
+  // absolute offset of chunk `i` (row-major order of chunks)
+  std::vector<hsize_t> chunkOffset(size_t i) const {
+    std::vector<hsize_t> coord(nchunks.size());
+    for (size_t d = nchunks.size(); d-- > 0;) {
+      coord[d] = grid_offset[d] + (i % nchunks[d]) * chunk_dims[d];
+      i /= nchunks[d];
+    }
+    return coord;
+  }
+
+  // inverse of `chunkOffset()`: row-major index of chunk starting at `coff`
+  size_t chunkIndex(const hsize_t* coff) const noexcept {
+    size_t i = 0;
+    for (size_t d = 0; d < nchunks.size(); d++)
+      i = i * nchunks[d] + (size_t(coff[d]) - grid_offset[d]) / chunk_dims[d];
+    return i;
+  }
+
+  // whether chunk starting at `coff` is entirely inside of the box
+  bool isFull(const std::vector<hsize_t>& coff) const noexcept {
+    for (size_t d = 0; d < coff.size(); d++)
+      if (coff[d] < offset[d] || coff[d] + chunk_dims[d] > offset[d] + count[d])
+        return false;
+    return true;
+  }
+
+  // copy the part of chunk starting at `coff` that lies inside of the box
+  // between `chunk` buffer and row-major `box` buffer
+  void copy(char* chunk, char* box, const std::vector<hsize_t>& coff,
+            size_t elem_size, bool box_to_chunk) const {
+    const size_t ndims = chunk_dims.size();
+    if (ndims == 0)
+      return;
+
+    // intersection of the chunk and the box relative to the chunk
+    std::vector<size_t> first(ndims), ext(ndims);
+    for (size_t d = 0; d < ndims; d++) {
+      first[d] = std::max(offset[d], size_t(coff[d])) - size_t(coff[d]);
+      ext[d] = std::min(size_t(coff[d]) + chunk_dims[d], offset[d] + count[d]) -
+          size_t(coff[d]) - first[d];
+    }
+
+    const size_t run = ext[ndims - 1] * elem_size;
+    std::vector<size_t> idx(first);
+    while (true) {
+      size_t chunk_pos = 0, box_pos = 0;
+      for (size_t d = 0; d < ndims; d++) {
+        chunk_pos = chunk_pos * chunk_dims[d] + idx[d];
+        box_pos = box_pos * count[d] + (coff[d] + idx[d] - offset[d]);
+      }
+      if (box_to_chunk)
+        std::memcpy(chunk + chunk_pos * elem_size, box + box_pos * elem_size, run);
+      else
+        std::memcpy(box + box_pos * elem_size, chunk + chunk_pos * elem_size, run);
+
+      // next row (the last dimension is copied at once)
+      size_t d = ndims - 1;
+      while (d-- > 0) {
+        if (++idx[d] < first[d] + ext[d])
+          break;
+        idx[d] = first[d];
+      }
+      if (d == size_t(-1))
+        return;
+    }
+  }
+};
+
+///
+/// \brief run `produce(i, slot)` for `i` in `[0, n)` on `nThreads` worker
+/// threads and `consume(i, slot)` on the calling thread in increasing
+/// order of `i`. At most `window` items are processed ahead of the consumer
+/// and `slot = i % window` may be used to index preallocated buffers.
+/// Only the calling thread is allowed to call HDF5 (`consume`)
+///
+template <typename Produce, typename Consume>
+inline void parallel_ordered(size_t n, size_t nThreads, size_t window,
+                             Produce&& produce, Consume&& consume) {
+  if (nThreads <= 1 || n <= 1) {
+    for (size_t i = 0; i < n; i++) {
+      produce(i, i % window);
+      consume(i, i % window);
+    }
+    return;
+  }
+
+  std::mutex m;
+  std::condition_variable cv;
+  std::vector<char> ready(n, 0);
+  size_t next = 0, consumed = 0;
+  bool failed = false;
+  std::exception_ptr error;
+
+  auto worker = [&]() {
+    while (true) {
+      size_t i;
+      {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&]{ return failed || next >= n || next < consumed + window; });
+        if (failed || next >= n)
+          return;
+        i = next++;
+      }
+
+      try {
+        produce(i, i % window);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m);
+        if (!failed)
+          error = std::current_exception();
+        failed = true;
+        cv.notify_all();
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m);
+        ready[i] = 1;
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < std::min(nThreads, n); t++)
+    threads.emplace_back(worker);
+
+  for (size_t i = 0; i < n; i++) {
+    {
+      std::unique_lock<std::mutex> lock(m);
+      cv.wait(lock, [&]{ return failed || ready[i]; });
+      if (failed)
+        break;
+    }
+
+    try {
+      consume(i, i % window);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m);
+      if (!failed)
+        error = std::current_exception();
+      failed = true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m);
+      consumed = i + 1;
+    }
+    cv.notify_all();
+    if (failed)
+      break;
+  }
+
+  for (auto& t : threads)
+    t.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+///
+/// \brief run `produce(i, slot)` for `i` in `[0, n)` on the calling thread
+/// in increasing order of `i` and `consume(i, slot)` on `nThreads` worker
+/// threads. At most `window` items are kept in memory and `slot = i % window`
+/// may be used to index preallocated buffers.
+/// Only the calling thread is allowed to call HDF5 (`produce`)
+///
+template <typename Produce, typename Consume>
+inline void parallel_feed(size_t n, size_t nThreads, size_t window,
+                          Produce&& produce, Consume&& consume) {
+  if (nThreads <= 1 || n <= 1) {
+    for (size_t i = 0; i < n; i++) {
+      produce(i, i % window);
+      consume(i, i % window);
+    }
+    return;
+  }
+
+  std::mutex m;
+  std::condition_variable cv;
+  std::vector<char> busy(window, 0);
+  std::vector<size_t> queue;
+  size_t queue_pos = 0;
+  bool done = false, failed = false;
+  std::exception_ptr error;
+
+  auto fail = [&]() {
+    std::lock_guard<std::mutex> lock(m);
+    if (!failed)
+      error = std::current_exception();
+    failed = true;
+    cv.notify_all();
+  };
+
+  auto worker = [&]() {
+    while (true) {
+      size_t i;
+      {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&]{ return failed || done || queue_pos < queue.size(); });
+        if (failed || queue_pos >= queue.size())
+          return;
+        i = queue[queue_pos++];
+      }
+
+      try {
+        consume(i, i % window);
+      } catch (...) {
+        fail();
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m);
+        busy[i % window] = 0;
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < std::min(nThreads, n); t++)
+    threads.emplace_back(worker);
+
+  for (size_t i = 0; i < n; i++) {
+    {
+      std::unique_lock<std::mutex> lock(m);
+      cv.wait(lock, [&]{ return failed || !busy[i % window]; });
+      if (failed)
+        break;
+    }
+
+    try {
+      produce(i, i % window);
+    } catch (...) {
+      fail();
+      break;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m);
+      busy[i % window] = 1;
+      queue.push_back(i);
+    }
+    cv.notify_all();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m);
+    done = true;
+  }
+  cv.notify_all();
+
+  for (auto& t : threads)
+    t.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+}  // namespace details
+
+}  // namespace h5gt
+
+#endif // H5CHUNK_MISC_HPP
@@ -11,11 +11,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <memory>
 #include <numeric>
 #include <sstream>
 #include <string>
 #include <array>
+#include <system_error>
+#include <thread>
 #include <type_traits>
 
 #ifdef H5GT_USE_BOOST
@@ -28,6 +33,7 @@
 #include <H5Dpublic.h>
 #include <H5Ppublic.h>
 
+#include "../H5PropertyList.hpp"
 #include "../H5Reference.hpp"
 #include "H5Utils.hpp"
 
@@ -193,38 +199,64 @@ struct container_converter {
   const DataType& _type;
 };
 
-// Generic container filled with struct (or class) converter
+// Generic container filled with struct (or class) converter.
+// Variable length string members are read by HDF5 as `char*` in place of
+// `std::string` objects and then converted in place. Offsets of such
+// members are cached along with the datatype (see `DataTypeRegistry`)
 template <typename Container, typename T = typename inspector<Container>::base_type>
 struct container_of_struct_converter {
   typedef T value_type;
 
-  inline container_of_struct_converter(const DataSpace& space, const DataType& type)
-    : _space(space), _type(type) {}
+  // strings converted by one thread at least
+  static constexpr size_t min_strings_per_thread = 32768;
 
-  inline void getVLenMemberAndOffsets(const DataType& type, std::vector<int>& vlen_members, std::vector<size_t>& member_offsets){
-    int nmembers = H5Tget_nmembers(type.getId());
-    int start_offset = 0;
-    for (int i = 0; i < nmembers; i++){
-      H5T_class_t memberclass = H5Tget_member_class(type.getId(), i);
-      if (memberclass == H5T_STRING){
-        DataType str_type = DataType::FromId(H5Tget_member_type(type.getId(), i), false);
-        if (str_type.isVariableStr()){
-          vlen_members.push_back(member_offsets.size());
-        }
-      } else if (memberclass == H5T_COMPOUND){
-        DataType nested_compound_type = DataType::FromId(H5Tget_member_type(type.getId(), i), false);
-        member_offsets.push_back(start_offset + H5Tget_member_offset(type.getId(), i));
-        getVLenMemberAndOffsets(nested_compound_type, vlen_members, member_offsets);
-        continue;
-      }
-      
-      if (i == 0 && member_offsets.size() != 0){
-        start_offset = member_offsets[member_offsets.size()-1];
-        continue;
+  inline container_of_struct_converter(const DataSpace& space, const DataType& type)
+    : _space(space), _type(type) {
+    if (type.getClass() != DataTypeClass::Compound)
+      return;
+    const DataType cached = DataTypeRegistry::get<value_type>();
+    _vlen_offsets = cached.getId(false) == type.getId(false) ?
+          DataTypeRegistry::getVLenStringOffsets<value_type>() :
+          vlen_string_offsets(type);
+  }
+
+  // Transfer properties to read the container with: strings are allocated
+  // from an arena released at once instead of being freed one by one.
+  // The user's vlen memory manager (if set) is kept and used to free them
+  inline DataTransferProps read_props(const DataTransferProps& xferProps) {
+    if (_vlen_offsets.empty())
+      return xferProps;
+
+    if (!xferProps.isDefault()) {
+      H5MM_allocate_t alloc_func = nullptr;
+      void* alloc_info = nullptr;
+      if (H5Pget_vlen_mem_manager(xferProps.getId(false),
+                                  &alloc_func, &alloc_info,
+                                  &_free_func, &_free_info) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+              "Unable to get variable length memory manager");
       }
+      if (alloc_func != nullptr)
+        return xferProps;
+      _free_func = nullptr;
+      _free_info = nullptr;
+    }
 
-      member_offsets.push_back(start_offset + H5Tget_member_offset(type.getId(), i));
+    // don't modify user's property list
+    DataTransferProps props = xferProps.isDefault() ?
+          DataTransferProps() :
+          DataTransferProps::FromId(H5Pcopy(xferProps.getId(false)), false);
+
+    // 16 bytes per string for the first block
+    _arena.reset(new BumpArena(
+                   compute_total_size(_space.getDimensions()) * _vlen_offsets.size() * 16));
+    if (H5Pset_vlen_mem_manager(props.getId(false),
+                                &BumpArena::allocate, _arena.get(),
+                                &BumpArena::deallocate, _arena.get()) < 0) {
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to set variable length memory manager");
     }
+    return props;
   }
 
   // Ship (pseudo)1D implementation
@@ -235,8 +267,10 @@ struct container_of_struct_converter {
     vec.resize(compute_total_size(dims));
     // we must explicitly call destructors as we probably will use placement new (for Compound with string)
     // https://www.cyberforum.ru/cpp-beginners/thread2924904-page2.html
-    for (size_t i = 0; i < vec.size(); i++){
-      vec[i].~value_type();
+    if (!_vlen_offsets.empty()) {
+      for (size_t i = 0; i < vec.size(); i++){
+        vec[i].~value_type();
+      }
     }
 
     return vec.data();
@@ -246,37 +280,92 @@ struct container_of_struct_converter {
     return vec.data();
   }
 
-  inline void process_result(Container& vec) noexcept {
-    if (_type.getClass() != DataTypeClass::Compound)
-      return;
+  inline void process_result(Container& vec) {
+    if (_vlen_offsets.empty())
+      return; // no variable length string
 
-    // check if compound contains variable length string
-    std::vector<int> vlen_members;
-    std::vector<size_t> member_offsets;
-    getVLenMemberAndOffsets(_type, vlen_members, member_offsets);
+    const size_t n = vec.size();
+    const size_t n_threads = std::min<size_t>(
+          std::max(std::thread::hardware_concurrency(), 1u),
+          n * _vlen_offsets.size() / min_strings_per_thread);
+    if (n_threads < 2) {
+      convert_strings(vec, 0, n);
+      return;
+    }
 
-    if (vlen_members.size() < 1)
-      return; // no variable length string
+    // started threads are joined on any exit: destroying
+    // a joinable `std::thread` calls `std::terminate`
+    struct Workers {
+      std::vector<std::thread> threads;
+      ~Workers() {
+        for (auto& thread : threads)
+          thread.join();
+      }
+    } workers;
+    workers.threads.reserve(n_threads);
+
+    const size_t step = (n + n_threads - 1) / n_threads;
+    size_t begin = 0;
+    try {
+      for (; begin < n; begin += step) {
+        workers.threads.emplace_back(
+              &container_of_struct_converter::convert_strings,
+              this, std::ref(vec), begin, std::min(begin + step, n));
+      }
+    } catch (const std::system_error&) {
+      // no more threads available: convert the rest here
+      convert_strings(vec, begin, n);
+    }
+  }
 
-    size_t nmembers = member_offsets.size();
-    size_t type_size = _type.getSize();
-    char * str_ptr;
-    for (size_t i = 0; i < vec.size(); i++){
-      int ind = 0;
-      for (int member = 0; member < nmembers; member++){
-        if (ind < vlen_members.size() && member == vlen_members[ind]){
-          memcpy(&str_ptr, (char *) vec.data() + member_offsets[member] + type_size*i, sizeof(str_ptr));
-          if (str_ptr) // important or undefined behaviour caused by std::string(char* == nullptr)
-            ::new((char *) vec.data() + member_offsets[member] + type_size*i) std::string(str_ptr); // placement new
-          std::free(str_ptr); // important
-          ind++;
+  // replace `char*` read in place of `std::string` members of
+  // elements [begin, end) by the strings they point to
+  inline void convert_strings(Container& vec, size_t begin, size_t end) const {
+    const size_t type_size = _type.getSize();
+    char* data = reinterpret_cast<char*>(vec.data());
+    for (size_t i = begin; i < end; i++) {
+      char* element = data + type_size * i;
+      for (size_t offset : _vlen_offsets) {
+        char* str_ptr;
+        std::memcpy(&str_ptr, element + offset, sizeof(str_ptr));
+        if (str_ptr == nullptr) {
+          // std::string(nullptr) is undefined behaviour
+          ::new(element + offset) std::string();
+          continue;
         }
+        ::new(element + offset) std::string(str_ptr);
+        if (_arena)
+          continue;
+        if (_free_func)
+          _free_func(str_ptr, _free_info);
+        else
+          std::free(str_ptr);
       }
     }
   }
 
   const DataSpace& _space;
   const DataType& _type;
+  std::vector<size_t> _vlen_offsets;
+  std::unique_ptr<BumpArena> _arena;
+  H5MM_free_t _free_func = nullptr;
+  void* _free_info = nullptr;
+};
+
+// Transfer properties required by converter `Conv` to read data:
+// `Conv::read_props()` if the converter defines it or `xferProps` as is
+template <typename Conv, typename = void>
+struct converter_read_props {
+  static const DataTransferProps& get(Conv&, const DataTransferProps& xferProps) {
+    return xferProps;
+  }
+};
+
+template <typename Conv>
+struct converter_read_props<Conv, std::void_t<decltype(&Conv::read_props)>> {
+  static DataTransferProps get(Conv& converter, const DataTransferProps& xferProps) {
+    return converter.read_props(xferProps);
+  }
 };
 
 
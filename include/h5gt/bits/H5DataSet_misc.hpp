@@ -20,9 +20,13 @@
 #endif
 
 #include <H5Dpublic.h>
+#include <H5FDsec2.h>
+#include <H5Fpublic.h>
 #include <H5Ppublic.h>
 
 #include "H5Utils.hpp"
+#include "H5Chunk_misc.hpp"
+#include "H5Mmap_misc.hpp"
 
 namespace h5gt {
 
@@ -142,6 +146,342 @@ inline void DataSet::resize(const std::vector<size_t>& dims) {
   }
 }
 
+template <typename T>
+inline void DataSet::writeParallel(const T* buffer,
+                                   const std::vector<size_t>& offset,
+                                   const std::vector<size_t>& count,
+                                   size_t nThreads,
+                                   const DataType& dtype,
+                                   const DataTransferProps& xferProps) {
+  using element_type = typename details::inspector<T>::base_type;
+  const DataType mem_datatype =
+      dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
+
+#if H5_VERSION_GE(1, 10, 3)
+  const std::vector<size_t> dims = getDimensions();
+  DataSetCreateProps createProps = getCreateProps();
+  bool direct = createProps.isChunked() &&
+      offset.size() == dims.size() && count.size() == dims.size() &&
+      !mem_datatype.isVariableStr() &&
+      H5Tdetect_class(mem_datatype.getId(false), H5T_VLEN) <= 0 &&
+      H5Tequal(mem_datatype.getId(false), getDataType().getId(false)) > 0 &&
+      !details::has_data_transform(xferProps.getId(false)) &&
+      !details::is_mpio_file(_hid);
+
+  // partial edge chunks may be left unfiltered by HDF5
+  unsigned chunk_opts = 0;
+  direct = direct && H5Pget_chunk_opts(createProps.getId(false), &chunk_opts) >= 0 &&
+      !(chunk_opts & H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS);
+
+  const size_t elem_size = mem_datatype.getSize();
+  details::ChunkPipeline pipeline;
+  direct = direct && pipeline.init(createProps.getId(false), elem_size);
+
+  std::vector<size_t> cdims;
+  if (direct) {
+    std::vector<hsize_t> chunk = createProps.getChunk(int(dims.size()));
+    cdims.assign(chunk.begin(), chunk.end());
+    for (size_t d = 0; d < dims.size(); d++) {
+      if (offset[d] % cdims[d] != 0 || offset[d] + count[d] > dims[d] ||
+          (count[d] % cdims[d] != 0 && offset[d] + count[d] != dims[d]))
+        direct = false;
+    }
+  }
+
+  if (!direct) {
+    select(offset, count).write_raw(buffer, mem_datatype, xferProps);
+    return;
+  }
+
+  details::ChunkBox box(offset, count, cdims);
+  const size_t chunk_bytes = box.chunkBytes(elem_size);
+
+  // edge chunks are padded with the fill value as HDF5 does
+  const std::vector<char> fill = details::get_fill_chunk(
+        createProps.getId(false), mem_datatype.getId(false),
+        elem_size, chunk_bytes);
+
+  nThreads = details::get_num_threads(nThreads);
+  const size_t window = 4 * nThreads;
+  std::vector<std::vector<char>> chunks(window);
+  std::vector<std::vector<hsize_t>> offsets(window);
+  std::vector<unsigned> masks(window);
+  char* box_data = const_cast<char*>(reinterpret_cast<const char*>(buffer));
+
+  details::parallel_ordered(
+        box.size(), nThreads, window,
+        [&](size_t i, size_t slot) {
+    std::vector<char>& chunk = chunks[slot];
+    offsets[slot] = box.chunkOffset(i);
+    if (box.isFull(offsets[slot]))
+      chunk.resize(chunk_bytes);
+    else
+      chunk = fill;
+    box.copy(chunk.data(), box_data, offsets[slot], elem_size, true);
+    masks[slot] = pipeline.encode(chunk);
+  },
+  [&](size_t, size_t slot) {
+    if (H5Dwrite_chunk(_hid, xferProps.getId(false), masks[slot],
+                       offsets[slot].data(), chunks[slot].size(),
+                       chunks[slot].data()) < 0) {
+      HDF5ErrMapper::ToException<DataSetException>("Unable to write chunk");
+    }
+  });
+#else
+  (void)nThreads;
+  select(offset, count).write_raw(buffer, mem_datatype, xferProps);
+#endif
+}
+
+template <typename T>
+inline const T* DataSetView<T>::data() const noexcept {
+  return _data;
+}
+
+template <typename T>
+inline const std::vector<size_t>& DataSetView<T>::getDimensions() const noexcept {
+  return _dims;
+}
+
+template <typename T>
+inline size_t DataSetView<T>::size() const noexcept {
+  size_t n = 1;
+  for (const auto& d : _dims)
+    n *= d;
+  return n;
+}
+
+template <typename T>
+inline bool DataSetView<T>::isMapped() const noexcept {
+  return _mapped;
+}
+
+template <typename T>
+inline const T& DataSetView<T>::operator[](size_t i) const noexcept {
+  return _data[i];
+}
+
+template <typename T>
+template <typename... Idx>
+inline const T& DataSetView<T>::operator()(Idx... idx) const noexcept {
+  const size_t ind[] = {size_t(idx)...};
+  size_t pos = 0;
+  for (size_t d = 0; d < sizeof...(Idx); d++)
+    pos = pos * _dims[d] + ind[d];
+  return _data[pos];
+}
+
+#ifdef H5GT_USE_EIGEN
+template <typename T>
+inline typename DataSetView<T>::EigenMap DataSetView<T>::asEigen() const {
+  if (_dims.size() > 2) {
+    throw DataSetException("Only 1D and 2D data can be viewed as Eigen matrix");
+  }
+  const Eigen::Index rows = _dims.empty() ? 1 : Eigen::Index(_dims[0]);
+  const Eigen::Index cols = _dims.size() < 2 ? 1 : Eigen::Index(_dims[1]);
+  return EigenMap(_data, rows, cols);
+}
+#endif
+
+template <typename T>
+inline DataSetView<T> DataSet::mapReadOnly() const {
+  using element_type = typename details::inspector<T>::base_type;
+  static_assert(std::is_same<T, element_type>::value,
+      "mapReadOnly() requires element type");
+  const DataType mem_datatype = create_and_check_datatype<T>();
+
+  DataSetView<T> view;
+  view._dims = getDimensions();
+
+  unsigned intent = 0;
+  hid_t file_id = H5Iget_file_id(_hid);
+  hid_t fapl = file_id < 0 ? -1 : H5Fget_access_plist(file_id);
+  DataSetCreateProps createProps = getCreateProps();
+  const bool mappable =
+      fapl >= 0 &&
+      H5Fget_intent(file_id, &intent) >= 0 && intent == H5F_ACC_RDONLY &&
+      H5Pget_driver(fapl) == H5FD_SEC2 &&
+      createProps.getLayoutType() == LayoutType::CONTIGUOUS &&
+      H5Pget_external_count(createProps.getId(false)) == 0 &&
+      H5Tequal(mem_datatype.getId(false), getDataType().getId(false)) > 0;
+  if (fapl >= 0)
+    H5Pclose(fapl);
+  if (file_id >= 0)
+    H5Fclose(file_id);
+
+  if (mappable) {
+    // unallocated dataset has no address, misaligned values can't
+    // be accessed through `const T*`
+    haddr_t addr = H5Dget_offset(_hid);
+    if (addr != HADDR_UNDEF && addr % alignof(T) == 0) {
+      std::shared_ptr<details::MappedRegion> region =
+          details::MappedRegion::map(getFileName(), size_t(addr),
+                                     view.size() * sizeof(T));
+      if (region) {
+        view._data = reinterpret_cast<const T*>(region->data());
+        view._holder = region;
+        view._mapped = true;
+        return view;
+      }
+    }
+  }
+
+  auto buffer = std::make_shared<std::vector<T>>(view.size());
+  read(buffer->data(), mem_datatype);
+  view._data = buffer->data();
+  view._holder = buffer;
+  return view;
+}
+
+inline const std::vector<size_t>& ChunkInfo::getOffset() const noexcept {
+  return offset;
+}
+
+inline haddr_t ChunkInfo::getAddress() const noexcept {
+  return address;
+}
+
+inline hsize_t ChunkInfo::getStorageSize() const noexcept {
+  return storage_size;
+}
+
+inline unsigned ChunkInfo::getFilterMask() const noexcept {
+  return filter_mask;
+}
+
+inline bool ChunkInfo::isAllocated() const noexcept {
+  return address != HADDR_UNDEF;
+}
+
+inline size_t DataSet::getNumberChunks() const {
+#if H5_VERSION_GE(1, 10, 5)
+  hsize_t nchunks = 0;
+  if (H5Dget_num_chunks(_hid, getSpace().getId(false), &nchunks) < 0) {
+    HDF5ErrMapper::ToException<DataSetException>(
+          "Unable to get number of chunks");
+  }
+  return nchunks;
+#else
+  HDF5ErrMapper::ToException<DataSetException>(
+        "Chunk info requires HDF5 1.10.5 or newer");
+  return 0;
+#endif
+}
+
+inline std::vector<ChunkInfo> DataSet::listChunks(bool storageOrder) const {
+  return _getChunks(storageOrder, true);
+}
+
+template <typename F>
+inline void DataSet::forEachChunkBlock(F&& func, bool storageOrder) const {
+  const std::vector<size_t> dims = getDimensions();
+  const std::vector<hsize_t> chunk = getCreateProps().getChunk(int(dims.size()));
+  std::vector<size_t> count(dims.size());
+  for (const ChunkInfo& info : _getChunks(storageOrder, false)) {
+    const std::vector<size_t>& offset = info.getOffset();
+    for (size_t d = 0; d < dims.size(); d++)
+      count[d] = std::min(size_t(chunk[d]), dims[d] - offset[d]);
+    const Selection sel = select(offset, count);
+    func(sel, info);
+  }
+}
+
+inline std::vector<ChunkInfo> DataSet::_getChunks(
+    bool storageOrder, bool allocatedOnly) const {
+  DataSetCreateProps createProps = getCreateProps();
+  if (!createProps.isChunked()) {
+    HDF5ErrMapper::ToException<DataSetException>(
+          "DataSet is not chunked");
+  }
+
+  const std::vector<size_t> dims = getDimensions();
+  std::vector<hsize_t> chunk = createProps.getChunk(int(dims.size()));
+  details::ChunkBox grid(std::vector<size_t>(dims.size(), 0), dims,
+                         std::vector<size_t>(chunk.begin(), chunk.end()));
+
+  std::vector<ChunkInfo> chunks;
+#if H5_VERSION_GE(1, 14, 0)
+  // a single pass over the chunk index visits only allocated chunks
+  // instead of probing every chunk of the grid
+  struct IterData {
+    const details::ChunkBox* grid;
+    std::vector<std::pair<size_t, ChunkInfo>> found;
+  } data{&grid, {}};
+
+  auto op = [](const hsize_t* offset, unsigned filter_mask, haddr_t addr,
+               hsize_t size, void* op_data) -> int {
+    IterData* d = static_cast<IterData*>(op_data);
+    try {
+      ChunkInfo info;
+      info.offset.assign(offset, offset + d->grid->nchunks.size());
+      info.filter_mask = filter_mask;
+      info.address = addr;
+      info.storage_size = size;
+      d->found.emplace_back(d->grid->chunkIndex(offset), std::move(info));
+    } catch (...) {
+      return H5_ITER_ERROR;
+    }
+    return H5_ITER_CONT;
+  };
+
+  if (H5Dchunk_iter(_hid, H5P_DEFAULT, op, &data) < 0) {
+    HDF5ErrMapper::ToException<DataSetException>(
+          "Unable to iterate over chunks");
+  }
+
+  if (allocatedOnly) {
+    std::sort(data.found.begin(), data.found.end(),
+              [](const std::pair<size_t, ChunkInfo>& a,
+                 const std::pair<size_t, ChunkInfo>& b) {
+      return a.first < b.first;
+    });
+    chunks.reserve(data.found.size());
+    for (auto& f : data.found)
+      chunks.push_back(std::move(f.second));
+  } else {
+    chunks.resize(grid.size());
+    for (size_t i = 0; i < grid.size(); i++) {
+      std::vector<hsize_t> coff = grid.chunkOffset(i);
+      chunks[i].offset.assign(coff.begin(), coff.end());
+    }
+    for (auto& f : data.found)
+      chunks[f.first] = std::move(f.second);
+  }
+#else
+  chunks.reserve(grid.size());
+  for (size_t i = 0; i < grid.size(); i++) {
+    std::vector<hsize_t> coff = grid.chunkOffset(i);
+    ChunkInfo info;
+#if H5_VERSION_GE(1, 10, 5)
+    // lookup by coordinates costs O(log n) while lookup by index
+    // iterates over the whole chunk index
+    if (H5Dget_chunk_info_by_coord(_hid, coff.data(), &info.filter_mask,
+                                   &info.address, &info.storage_size) < 0) {
+      HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get chunk info");
+    }
+#else
+    HDF5ErrMapper::ToException<DataSetException>(
+          "Chunk info requires HDF5 1.10.5 or newer");
+#endif
+    if (allocatedOnly && !info.isAllocated())
+      continue;
+
+    info.offset.assign(coff.begin(), coff.end());
+    chunks.push_back(std::move(info));
+  }
+#endif
+
+  // unallocated chunks have the largest address and go last
+  if (storageOrder) {
+    std::stable_sort(chunks.begin(), chunks.end(),
+                     [](const ChunkInfo& a, const ChunkInfo& b) {
+      return a.getAddress() < b.getAddress();
+    });
+  }
+  return chunks;
+}
+
 inline bool DataSet::operator==(const DataSet& other) const {
   return Object::operator==(other);
 }
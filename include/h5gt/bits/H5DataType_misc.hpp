@@ -9,9 +9,11 @@
 #ifndef H5DATATYPE_MISC_HPP
 #define H5DATATYPE_MISC_HPP
 
+#include <algorithm>
 #include <string>
 #include <complex>
 #include <cstring>
+#include <stdexcept>
 
 #include <H5Ppublic.h>
 #include <H5Tpublic.h>
@@ -397,6 +399,179 @@ inline std::string FixedLenStringArray<N>::getString(std::size_t i) const {
   return std::string(datavec[i].data());
 }
 
+inline StringTable::StringTable(const std::vector<std::string>& vec) {
+  for (const auto& str : vec)
+    push_back(str);
+}
+
+inline StringTable::StringTable(
+    const std::initializer_list<std::string_view>& list) {
+  for (const auto& str : list)
+    push_back(str);
+}
+
+inline void StringTable::push_back(std::string_view str) {
+  _arena.insert(_arena.end(), str.begin(), str.end());
+  _arena.push_back('\0');
+  _offsets.push_back(_arena.size());
+}
+
+inline std::vector<const char*> StringTable::getCStrings() const {
+  std::vector<const char*> ptrs(size());
+  for (std::size_t i = 0; i < ptrs.size(); i++)
+    ptrs[i] = _arena.data() + _offsets[i];
+  return ptrs;
+}
+
+inline std::string_view StringTable::at(std::size_t i) const {
+  if (i >= size()) {
+    throw std::out_of_range("StringTable index " + std::to_string(i) +
+                            " is out of range (size " + std::to_string(size()) + ")");
+  }
+  return (*this)[i];
+}
+
+namespace details {
+
+// bump allocator used as HDF5 vlen memory manager: sequences are
+// allocated from blocks of growing size and released all at once
+// with the arena
+class BumpArena {
+public:
+  explicit BumpArena(std::size_t capacity, std::vector<char>&& first = {}) {
+    first.resize(std::max(first.capacity(), capacity));
+    _blocks.push_back(std::move(first));
+  }
+
+  static void* allocate(std::size_t size, void* info) {
+    return static_cast<BumpArena*>(info)->bump(size);
+  }
+
+  static void deallocate(void*, void*) noexcept {}
+
+  std::vector<char>& firstBlock() noexcept {
+    return _blocks[0];
+  }
+
+  // number of bytes allocated so far
+  std::size_t used() const noexcept {
+    return _used_total;
+  }
+
+private:
+  void* bump(std::size_t size) {
+    std::vector<char>* block = &_blocks.back();
+    if (_used + size > block->size()) {
+      _blocks.emplace_back(std::max(2 * block->size(), size));
+      block = &_blocks.back();
+      _used = 0;
+    }
+    void* ptr = block->data() + _used;
+    _used += size;
+    _used_total += size;
+    return ptr;
+  }
+
+  std::vector<std::vector<char>> _blocks;
+  std::size_t _used = 0;
+  std::size_t _used_total = 0;
+};
+
+// variable length strings arena whose first block is the arena of the
+// StringTable being read (that keeps its capacity between reads)
+class StringArena {
+public:
+  // the table is empty until `finish()`: its arena is borrowed
+  StringArena(StringTable& table, std::size_t capacity)
+    : _table(table), _arena(capacity, std::move(table._arena)) {
+    _table._offsets.assign(1, 0);
+  }
+
+  // give the arena back to the table if the read failed
+  ~StringArena() {
+    if (_finished)
+      return;
+    _table._arena = std::move(_arena.firstBlock());
+    _table._arena.clear();
+  }
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  static void* allocate(std::size_t size, void* info) {
+    return BumpArena::allocate(size, &static_cast<StringArena*>(info)->_arena);
+  }
+
+  static void deallocate(void*, void*) noexcept {}
+
+  // fill the table with strings pointed by `ptrs` (NULL is empty string).
+  // Strings allocated one after another in the first block are taken
+  // as is, otherwise they are copied to a new arena in the given order
+  void finish(const std::vector<const char*>& ptrs) {
+    _finished = true;
+    std::vector<std::size_t>& offsets = _table._offsets;
+    offsets.resize(ptrs.size() + 1);
+    offsets[0] = 0;
+
+    std::vector<char>& first = _arena.firstBlock();
+    const char* base = first.data();
+    bool in_place = true;
+    for (std::size_t i = 0; i < ptrs.size() && in_place; i++) {
+      in_place = ptrs[i] == base + offsets[i];
+      if (in_place)
+        offsets[i + 1] = offsets[i] + std::strlen(ptrs[i]) + 1;
+    }
+
+    if (in_place) {
+      _table._arena = std::move(first);
+      _table._arena.resize(offsets.back());
+      return;
+    }
+
+    std::vector<char>& arena = _table._arena;
+    arena.clear();
+    arena.reserve(_arena.used());
+    for (std::size_t i = 0; i < ptrs.size(); i++) {
+      if (ptrs[i] != nullptr)
+        arena.insert(arena.end(), ptrs[i], ptrs[i] + std::strlen(ptrs[i]));
+      arena.push_back('\0');
+      offsets[i + 1] = arena.size();
+    }
+  }
+
+private:
+  StringTable& _table;
+  BumpArena _arena;
+  bool _finished = false;
+};
+
+// absolute offsets of variable length string members of compound `type`,
+// members of nested compounds included
+inline void vlen_string_offsets(hid_t type, std::size_t base,
+                                std::vector<std::size_t>& offsets) {
+  const int nmembers = H5Tget_nmembers(type);
+  for (int i = 0; i < nmembers; i++) {
+    const H5T_class_t member_class = H5Tget_member_class(type, unsigned(i));
+    if (member_class != H5T_STRING && member_class != H5T_COMPOUND)
+      continue;
+    const std::size_t offset = base + H5Tget_member_offset(type, unsigned(i));
+    DataType member_type = DataType::FromId(H5Tget_member_type(type, unsigned(i)), false);
+    if (member_class == H5T_COMPOUND)
+      vlen_string_offsets(member_type.getId(false), offset, offsets);
+    else if (member_type.isVariableStr())
+      offsets.push_back(offset);
+  }
+}
+
+inline std::vector<std::size_t> vlen_string_offsets(const DataType& type) {
+  std::vector<std::size_t> offsets;
+  if (type.getClass() == DataTypeClass::Compound)
+    vlen_string_offsets(type.getId(false), 0, offsets);
+  return offsets;
+}
+
+}  // namespace details
+
 // Internal
 // Reference mapping
 template <>
@@ -614,18 +789,18 @@ inline DataType create_datatype() {
   return AtomicType<T>();
 }
 
-/// \brief Create a DataType instance representing type T and perform a sanity check on its size
-template <typename T>
-inline DataType create_and_check_datatype() {
+namespace details {
 
-  DataType t = create_datatype<T>();
+// check that the size of `T` matches the size of memory datatype `t`
+template <typename T>
+inline void check_datatype(const DataType& t) {
   if (t.empty()) {
     throw DataTypeException("Type given to create_and_check_datatype is not valid");
   }
 
   // Skip check if the base type is a variable length string
   if (t.isVariableStr()) {
-    return t;
+    return;
   }
 
   // Check that the size of the template type matches the size that HDF5 is
@@ -637,10 +812,252 @@ inline DataType create_and_check_datatype() {
        << std::endl;
     throw DataTypeException(ss.str());
   }
+}
+
+}  // namespace details
+
+
+template <typename T>
+inline DataType DataTypeRegistry::get() {
+  return lookup<T, false>();
+}
+
+template <typename T>
+inline DataType DataTypeRegistry::getChecked() {
+  return lookup<T, true>();
+}
+
+template <typename T>
+inline std::vector<size_t> DataTypeRegistry::getVLenStringOffsets() {
+  std::vector<size_t> offsets;
+  lookup<T, false>(&offsets);
+  return offsets;
+}
+
+inline void DataTypeRegistry::invalidate() noexcept {
+  clear(true);
+}
+
+inline void DataTypeRegistry::forget() noexcept {
+  clear(false);
+}
+
+inline void DataTypeRegistry::clear(bool close) noexcept {
+  std::lock_guard<std::mutex> lock(mutex());
+  for (Slot* slot : slots()) {
+    if (close)
+      slot->type.reset();
+    else
+      (void)slot->type.release();  // ids are invalid, nothing to close
+    slot->vlen_str_offsets.clear();
+    slot->generation = 0;
+  }
+  ++generation();
+}
+
+inline size_t DataTypeRegistry::getHitCount() noexcept {
+  return hits().load(std::memory_order_relaxed);
+}
+
+inline size_t DataTypeRegistry::getMissCount() noexcept {
+  return misses().load(std::memory_order_relaxed);
+}
+
+inline void DataTypeRegistry::resetCounters() noexcept {
+  hits().store(0, std::memory_order_relaxed);
+  misses().store(0, std::memory_order_relaxed);
+}
+
+template <typename T, bool Checked>
+inline DataType DataTypeRegistry::lookup(std::vector<size_t>* vlen_str_offsets) {
+  static Slot* slot = addSlot();
+
+  size_t gen;
+  {
+    std::lock_guard<std::mutex> lock(mutex());
+    gen = generation().load(std::memory_order_relaxed);
+    if (slot->generation == gen) {
+      hits().fetch_add(1, std::memory_order_relaxed);
+      if (vlen_str_offsets)
+        *vlen_str_offsets = slot->vlen_str_offsets;
+      return *slot->type;
+    }
+  }
 
+  // build without holding the lock: user defined `create_datatype`
+  // specializations may request other types from the registry
+  misses().fetch_add(1, std::memory_order_relaxed);
+  DataType t = build<T, Checked>();
+  std::vector<size_t> offsets = details::vlen_string_offsets(t);
+
+  std::lock_guard<std::mutex> lock(mutex());
+  if (slot->generation != generation().load(std::memory_order_relaxed) &&
+      gen == generation().load(std::memory_order_relaxed)) {
+    slot->type.reset(new DataType(t));
+    slot->vlen_str_offsets = offsets;
+    slot->generation = gen;
+  }
+  if (vlen_str_offsets)
+    *vlen_str_offsets = std::move(offsets);
+  return t;
+}
+
+template <typename T, bool Checked>
+inline DataType DataTypeRegistry::build() {
+  DataType t = create_datatype<T>();
+  if (Checked)
+    details::check_datatype<T>(t);
   return t;
 }
 
+inline std::mutex& DataTypeRegistry::mutex() noexcept {
+  static std::mutex m;
+  return m;
+}
+
+inline DataTypeRegistry::Slot* DataTypeRegistry::addSlot() {
+  // never destroyed: HDF5 may already be terminated when
+  // static objects are destroyed at exit
+  Slot* slot = new Slot();
+  std::lock_guard<std::mutex> lock(mutex());
+  slots().push_back(slot);
+  return slot;
+}
+
+inline std::vector<DataTypeRegistry::Slot*>& DataTypeRegistry::slots() noexcept {
+  static std::vector<Slot*>* s = new std::vector<Slot*>();
+  return *s;
+}
+
+inline std::atomic<size_t>& DataTypeRegistry::generation() noexcept {
+  static std::atomic<size_t> g(1);
+  return g;
+}
+
+inline std::atomic<size_t>& DataTypeRegistry::hits() noexcept {
+  static std::atomic<size_t> n(0);
+  return n;
+}
+
+inline std::atomic<size_t>& DataTypeRegistry::misses() noexcept {
+  static std::atomic<size_t> n(0);
+  return n;
+}
+
+/// \brief Create a DataType instance representing type T and perform a sanity check on its size
+template <typename T>
+inline DataType create_and_check_datatype() {
+  return DataTypeRegistry::getChecked<T>();
+}
+
+namespace details {
+
+template <typename T, bool = reflection<T>::value>
+struct is_packed_reflection : std::false_type {};
+
+template <typename T>
+struct is_packed_reflection<T, true>
+  : std::integral_constant<bool, reflection<T>::is_packed> {};
+
+// datatype of a member of a struct described with `H5GT_REFLECT` and
+// whether its memory and packed datatypes are the same
+template <typename T>
+struct member_traits_impl {
+  static constexpr bool packed =
+      std::is_arithmetic<T>::value || std::is_enum<T>::value ||
+      is_packed_reflection<T>::value;
+
+  static DataType datatype() {
+    return DataTypeRegistry::get<T>();
+  }
+};
+
+// fixed-len string
+template <std::size_t N>
+struct member_traits_impl<char[N]> {
+  static constexpr bool packed = true;
+
+  static DataType datatype() {
+    return DataTypeRegistry::get<char[N]>();
+  }
+};
+
+template <typename T, std::size_t N>
+struct member_traits_impl<T[N]> {
+  static constexpr bool packed = member_traits_impl<T>::packed;
+
+  static DataType datatype() {
+    const hsize_t dims[1] = {N};
+    hid_t hid = H5Tarray_create2(
+          member_traits_impl<T>::datatype().getId(false), 1, dims);
+    if (hid < 0) {
+      HDF5ErrMapper::ToException<DataTypeException>(
+            "Unable to create array datatype");
+    }
+    return DataType::FromId(hid, false);
+  }
+};
+
+template <typename T, std::size_t N>
+struct member_traits_impl<std::array<T, N>> : member_traits_impl<T[N]> {};
+
+template <typename T>
+struct member_traits : member_traits_impl<typename std::remove_cv<T>::type> {};
+
+// members don't overlap, fit the struct and are listed in declaration order
+template <std::size_t N>
+constexpr bool is_ordered_layout(const std::array<reflected_member, N>& members,
+                                 std::size_t size) {
+  for (std::size_t i = 0; i < N; i++) {
+    if (members[i].offset + members[i].size > size)
+      return false;
+    if (i > 0 && members[i].offset < members[i - 1].offset + members[i - 1].size)
+      return false;
+  }
+  return true;
+}
+
+// members cover the whole struct without padding
+template <std::size_t N>
+constexpr bool is_packed_layout(const std::array<reflected_member, N>& members,
+                                std::size_t size) {
+  std::size_t end = 0;
+  for (std::size_t i = 0; i < N; i++) {
+    if (!members[i].packed || members[i].offset != end)
+      return false;
+    end += members[i].size;
+  }
+  return end == size;
+}
+
+template <typename T>
+inline DataType reflected_datatype() {
+  std::vector<CompoundType::member_def> members;
+  members.reserve(reflection<T>::members.size());
+  for (const auto& member : reflection<T>::members)
+    members.emplace_back(member.name, member.datatype(), member.offset);
+  return CompoundType(std::move(members), sizeof(T));
+}
+
+}  // namespace details
+
+template <typename T>
+inline DataType create_packed_datatype() {
+  DataType t = DataTypeRegistry::get<T>();
+  if (details::is_packed_reflection<T>::value ||
+      t.getClass() != DataTypeClass::Compound)
+    return t;
+
+  hid_t hid = H5Tcopy(t.getId(false));
+  if (hid < 0 || H5Tpack(hid) < 0) {
+    if (hid >= 0)
+      H5Tclose(hid);
+    HDF5ErrMapper::ToException<DataTypeException>(
+          "Unable to create packed datatype");
+  }
+  return DataType::FromId(hid, false);
+}
+
 }  // namespace h5gt
 
 
@@ -10,10 +10,101 @@
 #ifndef H5FILEDRIVER_MISC_HPP
 #define H5FILEDRIVER_MISC_HPP
 
+#include <H5FDcore.h>
+#include <H5FDfamily.h>
+#include <H5FDmulti.h>
+#include <H5FDsec2.h>
 #include <H5Ppublic.h>
+#ifdef H5_HAVE_DIRECT
+#include <H5FDdirect.h>
+#endif
 
 namespace h5gt {
 
+inline Sec2FileDriver::Sec2FileDriver(hsize_t threshold, hsize_t alignment) {
+  if (H5Pset_fapl_sec2(_hid) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to set-up sec2 driver configuration");
+  }
+  setAlignment(threshold, alignment);
+}
+
+inline CoreFileDriver::CoreFileDriver(size_t increment, bool backingStore) {
+  if (H5Pset_fapl_core(_hid, increment, backingStore) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to set-up core driver configuration");
+  }
+}
+
+inline size_t CoreFileDriver::getIncrement() {
+  size_t increment;
+  hbool_t backingStore;
+  if (H5Pget_fapl_core(_hid, &increment, &backingStore) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to get core driver configuration");
+  }
+  return increment;
+}
+
+inline bool CoreFileDriver::getBackingStore() {
+  size_t increment;
+  hbool_t backingStore;
+  if (H5Pget_fapl_core(_hid, &increment, &backingStore) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to get core driver configuration");
+  }
+  return backingStore;
+}
+
+inline FamilyFileDriver::FamilyFileDriver(
+    hsize_t memberSize, const FileAccessProps& memberProps) {
+  if (H5Pset_fapl_family(_hid, memberSize, memberProps.getId(false)) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to set-up family driver configuration");
+  }
+}
+
+inline hsize_t FamilyFileDriver::getMemberSize() {
+  hsize_t memberSize;
+  hid_t memberProps;
+  if (H5Pget_fapl_family(_hid, &memberSize, &memberProps) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to get family driver configuration");
+  }
+  H5Pclose(memberProps);
+  return memberSize;
+}
+
+inline SplitFileDriver::SplitFileDriver(
+    const std::string& metaExt, const std::string& rawExt,
+    const FileAccessProps& metaProps, const FileAccessProps& rawProps) {
+  if (H5Pset_fapl_split(_hid, metaExt.c_str(), metaProps.getId(false),
+                        rawExt.c_str(), rawProps.getId(false)) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to set-up split driver configuration");
+  }
+}
+
+#ifdef H5_HAVE_DIRECT
+
+inline DirectFileDriver::DirectFileDriver(
+    size_t alignment, size_t blockSize, size_t cbufSize) {
+  if (H5Pset_fapl_direct(_hid, alignment, blockSize, cbufSize) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to set-up direct driver configuration");
+  }
+}
+
+inline void DirectFileDriver::getFaplDirect(
+    size_t& alignment, size_t& blockSize, size_t& cbufSize) {
+  if (H5Pget_fapl_direct(_hid, &alignment, &blockSize, &cbufSize) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          "Unable to get direct driver configuration");
+  }
+}
+
+#endif
+
 #ifdef H5GT_PARALLEL
 
 inline MPIOFileDriver::MPIOFileDriver(MPI_Comm comm, MPI_Info info) {
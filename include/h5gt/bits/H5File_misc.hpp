@@ -39,7 +39,8 @@ inline unsigned convert_open_flag(unsigned openFlags) {
 
 
 inline File::File(const std::string& filename, unsigned openFlags,
-                  const FileAccessProps& fileAccessProps){
+                  const FileAccessProps& fileAccessProps,
+                  const FileCreateProps& fileCreateProps){
 
   openFlags = convert_open_flag(openFlags);
 
@@ -68,7 +69,8 @@ inline File::File(const std::string& filename, unsigned openFlags,
     }
   }
 
-  if ((_hid = H5Fcreate(filename.c_str(), createMode, H5P_DEFAULT,
+  if ((_hid = H5Fcreate(filename.c_str(), createMode,
+                        fileCreateProps.getId(false),
                         fileAccessProps.getId(false))) < 0) {
     HDF5ErrMapper::ToException<FileException>(
           std::string("Unable to create file " + filename +
@@ -99,6 +101,56 @@ inline bool File::operator!=(const File& other) const {
   return !(*this == other);
 }
 
+inline H5AC_cache_config_t File::getMdcConfig() const {
+  H5AC_cache_config_t config;
+  config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Fget_mdc_config(_hid, &config) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          std::string("Unable to get metadata cache config for " + getFileName()));
+  }
+  return config;
+}
+
+inline void File::setMdcConfig(const H5AC_cache_config_t& config) const {
+  H5AC_cache_config_t c = config;
+  c.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Fset_mdc_config(_hid, &c) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          std::string("Unable to set metadata cache config for " + getFileName()));
+  }
+}
+
+inline double File::getMdcHitRate() const {
+  double hitRate;
+  if (H5Fget_mdc_hit_rate(_hid, &hitRate) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          std::string("Unable to get metadata cache hit rate for " + getFileName()));
+  }
+  return hitRate;
+}
+
+inline void File::resetMdcHitRateStats() const {
+  if (H5Freset_mdc_hit_rate_stats(_hid) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          std::string("Unable to reset metadata cache hit rate stats for " + getFileName()));
+  }
+}
+
+inline size_t File::getMdcSize() const {
+  size_t maxSize, minCleanSize, curSize;
+  int curNumEntries;
+  getMdcSize(maxSize, minCleanSize, curSize, curNumEntries);
+  return curSize;
+}
+
+inline void File::getMdcSize(size_t& maxSize, size_t& minCleanSize,
+                             size_t& curSize, int& curNumEntries) const {
+  if (H5Fget_mdc_size(_hid, &maxSize, &minCleanSize, &curSize, &curNumEntries) < 0) {
+    HDF5ErrMapper::ToException<FileException>(
+          std::string("Unable to get metadata cache size for " + getFileName()));
+  }
+}
+
 }  // namespace h5gt
 
 #endif  // H5FILE_MISC_HPP
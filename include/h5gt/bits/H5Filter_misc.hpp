@@ -0,0 +1,458 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5FILTER_MISC_HPP
+#define H5FILTER_MISC_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <H5Ppublic.h>
+#include <H5Tpublic.h>
+#include <H5Zpublic.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace h5gt {
+
+namespace details {
+
+#if defined(__SSE2__)
+
+// split bytes of `a` and `b` by parity of their index:
+// `even` gets bytes 0, 2, 4... of `a` then of `b`, `odd` gets bytes 1, 3, 5...
+inline void deinterleave_bytes(__m128i a, __m128i b,
+                               __m128i& even, __m128i& odd) noexcept {
+  const __m128i mask = _mm_set1_epi16(0x00FF);
+  even = _mm_packus_epi16(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+  odd = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+}
+
+// shuffle 16 elements of size `N` (N registers). Each pass splits bytes by
+// one more bit of their index within the element, after log2(N) passes
+// register `j` holds byte `j` of every element
+template <size_t N>
+inline void shuffle_block_sse2(const char* src, char* dst, size_t n) noexcept {
+  __m128i v[N], w[N];
+  for (size_t k = 0; k < N; k++)
+    v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src) + k);
+
+  for (size_t pass = 1; pass < N; pass *= 2) {
+    for (size_t k = 0; k < N / 2; k++)
+      deinterleave_bytes(v[2 * k], v[2 * k + 1], w[k], w[k + N / 2]);
+    for (size_t k = 0; k < N; k++)
+      v[k] = w[k];
+  }
+
+  for (size_t j = 0; j < N; j++)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j * n), v[j]);
+}
+
+// inverse of `shuffle_block_sse2`
+template <size_t N>
+inline void unshuffle_block_sse2(const char* src, char* dst, size_t n) noexcept {
+  __m128i v[N], w[N];
+  for (size_t j = 0; j < N; j++)
+    v[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j * n));
+
+  for (size_t pass = 1; pass < N; pass *= 2) {
+    for (size_t k = 0; k < N / 2; k++) {
+      w[2 * k] = _mm_unpacklo_epi8(v[k], v[k + N / 2]);
+      w[2 * k + 1] = _mm_unpackhi_epi8(v[k], v[k + N / 2]);
+    }
+    for (size_t k = 0; k < N; k++)
+      v[k] = w[k];
+  }
+
+  for (size_t k = 0; k < N; k++)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst) + k, v[k]);
+}
+
+#endif
+
+// shuffle elements of compile time size, blocks of 16 elements are vectorized
+template <size_t N>
+inline void shuffle_fixed(const char* src, char* dst, size_t n) noexcept {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= n; i += 16)
+    shuffle_block_sse2<N>(src + i * N, dst + i, n);
+#endif
+  for (; i < n; i++)
+    for (size_t j = 0; j < N; j++)
+      dst[j * n + i] = src[i * N + j];
+}
+
+template <size_t N>
+inline void unshuffle_fixed(const char* src, char* dst, size_t n) noexcept {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= n; i += 16)
+    unshuffle_block_sse2<N>(src + i, dst + i * N, n);
+#endif
+  for (; i < n; i++)
+    for (size_t j = 0; j < N; j++)
+      dst[i * N + j] = src[j * n + i];
+}
+
+// byte transposition identical to HDF5 shuffle filter (H5Zshuffle.c)
+inline void shuffle_bytes(const char* src, char* dst,
+                          size_t nbytes, size_t elem_size) noexcept {
+  const size_t n = nbytes / elem_size;
+  if (elem_size <= 1 || n <= 1) {
+    std::memcpy(dst, src, nbytes);
+    return;
+  }
+
+  switch (elem_size) {
+  case 2: shuffle_fixed<2>(src, dst, n); break;
+  case 4: shuffle_fixed<4>(src, dst, n); break;
+  case 8: shuffle_fixed<8>(src, dst, n); break;
+  default:
+    for (size_t j = 0; j < elem_size; j++)
+      for (size_t i = 0; i < n; i++)
+        dst[j * n + i] = src[i * elem_size + j];
+  }
+
+  const size_t leftover = nbytes % elem_size;
+  std::memcpy(dst + nbytes - leftover, src + nbytes - leftover, leftover);
+}
+
+// inverse of `shuffle_bytes`
+inline void unshuffle_bytes(const char* src, char* dst,
+                            size_t nbytes, size_t elem_size) noexcept {
+  const size_t n = nbytes / elem_size;
+  if (elem_size <= 1 || n <= 1) {
+    std::memcpy(dst, src, nbytes);
+    return;
+  }
+
+  switch (elem_size) {
+  case 2: unshuffle_fixed<2>(src, dst, n); break;
+  case 4: unshuffle_fixed<4>(src, dst, n); break;
+  case 8: unshuffle_fixed<8>(src, dst, n); break;
+  default:
+    for (size_t j = 0; j < elem_size; j++)
+      for (size_t i = 0; i < n; i++)
+        dst[i * elem_size + j] = src[j * n + i];
+  }
+
+  const size_t leftover = nbytes % elem_size;
+  std::memcpy(dst + nbytes - leftover, src + nbytes - leftover, leftover);
+}
+
+// transpose 8x8 bit matrix: byte `k` of the result holds bit `k`
+// of every byte `i` of `x` at bit `i` (Hacker's Delight, 7-3)
+inline uint64_t transpose_bits8(uint64_t x) noexcept {
+  uint64_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+  x = x ^ t ^ (t << 28);
+  return x;
+}
+
+inline uint64_t load_le64(const char* p) noexcept {
+  uint64_t x = 0;
+  for (size_t i = 0; i < 8; i++)
+    x |= uint64_t(static_cast<unsigned char>(p[i])) << (8 * i);
+  return x;
+}
+
+// transpose bits of a byte row of `nbytes` (multiple of 8):
+// bit row `k` (`nbytes / 8` bytes) gets bit `k` of every byte
+inline void shuffle_bit_row(const char* src, char* dst, size_t nbytes) noexcept {
+  const size_t row = nbytes / 8;
+  size_t i = 0;
+#if defined(__SSE2__)
+  // most significant bits of 16 bytes at once
+  for (; i + 16 <= nbytes; i += 16) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    for (size_t k = 8; k-- > 0;) {
+      const int mask = _mm_movemask_epi8(x);
+      dst[k * row + i / 8] = char(mask & 0xFF);
+      dst[k * row + i / 8 + 1] = char(mask >> 8);
+      x = _mm_slli_epi16(x, 1);
+    }
+  }
+#endif
+  for (; i < nbytes; i += 8) {
+    const uint64_t x = transpose_bits8(load_le64(src + i));
+    for (size_t k = 0; k < 8; k++)
+      dst[k * row + i / 8] = char((x >> (8 * k)) & 0xFF);
+  }
+}
+
+// inverse of `shuffle_bit_row`
+inline void unshuffle_bit_row(const char* src, char* dst, size_t nbytes) noexcept {
+  const size_t row = nbytes / 8;
+  for (size_t i = 0; i < nbytes; i += 8) {
+    uint64_t x = 0;
+    for (size_t k = 0; k < 8; k++)
+      x |= uint64_t(static_cast<unsigned char>(src[k * row + i / 8])) << (8 * k);
+    x = transpose_bits8(x);
+    for (size_t b = 0; b < 8; b++)
+      dst[i + b] = char((x >> (8 * b)) & 0xFF);
+  }
+}
+
+inline bool is_little_endian() noexcept {
+  const uint16_t one = 1;
+  return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+template <typename U>
+inline void delta_encode_fixed(const char* src, char* dst, size_t n) noexcept {
+  U prev = 0;
+  for (size_t i = 0; i < n; i++) {
+    U x;
+    std::memcpy(&x, src + i * sizeof(U), sizeof(U));
+    const U d = U(x - prev);
+    std::memcpy(dst + i * sizeof(U), &d, sizeof(U));
+    prev = x;
+  }
+}
+
+template <typename U>
+inline void delta_decode_fixed(const char* src, char* dst, size_t n) noexcept {
+  U prev = 0;
+  for (size_t i = 0; i < n; i++) {
+    U d;
+    std::memcpy(&d, src + i * sizeof(U), sizeof(U));
+    prev = U(prev + d);
+    std::memcpy(dst + i * sizeof(U), &prev, sizeof(U));
+  }
+}
+
+// stored after element size in filter values of codecs registered with
+// `registerFilter<Codec>()` to tell them from filters of other tools
+// that use the same id ("h5gt")
+constexpr unsigned codec_signature = 0x68356774;
+
+inline bool has_codec_signature(size_t cd_nelmts, const unsigned cd_values[]) noexcept {
+  return cd_nelmts == 2 && cd_values[0] != 0 && cd_values[1] == codec_signature;
+}
+
+template <typename Codec>
+herr_t codec_set_local(hid_t dcpl, hid_t type, hid_t) {
+  unsigned flags;
+  size_t cd_nelmts = 0;
+  if (H5Pget_filter_by_id2(dcpl, Codec::id, &flags, &cd_nelmts,
+                           NULL, 0, NULL, NULL) < 0)
+    return -1;
+
+  const size_t elem_size = H5Tget_size(type);
+  if (elem_size == 0)
+    return -1;
+
+  // the same as HDF5 shuffle filter does
+  const unsigned cd_values[2] = {unsigned(elem_size), codec_signature};
+  return H5Pmodify_filter(dcpl, Codec::id, flags, 2, cd_values);
+}
+
+template <typename Codec>
+size_t codec_filter(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                    size_t nbytes, size_t* buf_size, void** buf) {
+  if (!has_codec_signature(cd_nelmts, cd_values) || nbytes == 0)
+    return 0;
+
+  void* out = H5allocate_memory(nbytes, false);
+  if (out == NULL)
+    return 0;
+
+  // exceptions must not propagate to HDF5
+  try {
+    if (flags & H5Z_FLAG_REVERSE)
+      Codec::decode(static_cast<const char*>(*buf), static_cast<char*>(out),
+                    nbytes, cd_values[0]);
+    else
+      Codec::encode(static_cast<const char*>(*buf), static_cast<char*>(out),
+                    nbytes, cd_values[0]);
+  } catch (...) {
+    H5free_memory(out);
+    return 0;
+  }
+
+  H5free_memory(*buf);
+  *buf = out;
+  *buf_size = nbytes;
+  return nbytes;
+}
+
+}  // namespace details
+
+inline H5Z_filter_t FilterInfo::getId() const noexcept {
+  return id;
+}
+
+inline unsigned FilterInfo::getFlags() const noexcept {
+  return flags;
+}
+
+inline bool FilterInfo::isOptional() const noexcept {
+  return flags & H5Z_FLAG_OPTIONAL;
+}
+
+inline const std::vector<unsigned>& FilterInfo::getCdValues() const noexcept {
+  return cd_values;
+}
+
+inline const std::string& FilterInfo::getName() const noexcept {
+  return name;
+}
+
+inline unsigned FilterInfo::getFilterConfig() const noexcept {
+  return filter_config;
+}
+
+inline void ByteShuffleFilter::encode(const char* src, char* dst,
+                                      size_t nbytes, size_t elemSize) noexcept {
+  details::shuffle_bytes(src, dst, nbytes, elemSize);
+}
+
+inline void ByteShuffleFilter::decode(const char* src, char* dst,
+                                      size_t nbytes, size_t elemSize) noexcept {
+  details::unshuffle_bytes(src, dst, nbytes, elemSize);
+}
+
+inline void BitShuffleFilter::encode(const char* src, char* dst,
+                                     size_t nbytes, size_t elemSize) {
+  const size_t n8 = nbytes / elemSize / 8 * 8;
+  const size_t block = n8 * elemSize;
+
+  // byte rows then bit rows within each byte row
+  std::vector<char> tmp(block);
+  details::shuffle_bytes(src, tmp.data(), block, elemSize);
+  for (size_t j = 0; j < elemSize; j++)
+    details::shuffle_bit_row(tmp.data() + j * n8, dst + j * n8, n8);
+
+  std::memcpy(dst + block, src + block, nbytes - block);
+}
+
+inline void BitShuffleFilter::decode(const char* src, char* dst,
+                                     size_t nbytes, size_t elemSize) {
+  const size_t n8 = nbytes / elemSize / 8 * 8;
+  const size_t block = n8 * elemSize;
+
+  std::vector<char> tmp(block);
+  for (size_t j = 0; j < elemSize; j++)
+    details::unshuffle_bit_row(src + j * n8, tmp.data() + j * n8, n8);
+  details::unshuffle_bytes(tmp.data(), dst, block, elemSize);
+
+  std::memcpy(dst + block, src + block, nbytes - block);
+}
+
+inline void DeltaFilter::encode(const char* src, char* dst,
+                                size_t nbytes, size_t elemSize) noexcept {
+  const size_t n = nbytes / elemSize;
+  if (details::is_little_endian() && elemSize == 1) {
+    details::delta_encode_fixed<uint8_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 2) {
+    details::delta_encode_fixed<uint16_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 4) {
+    details::delta_encode_fixed<uint32_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 8) {
+    details::delta_encode_fixed<uint64_t>(src, dst, n);
+  } else {
+    // subtraction with borrow, least significant byte first
+    for (size_t i = n; i-- > 0;) {
+      unsigned borrow = 0;
+      for (size_t b = 0; b < elemSize; b++) {
+        const unsigned x = static_cast<unsigned char>(src[i * elemSize + b]);
+        const unsigned prev = i > 0 ?
+              static_cast<unsigned char>(src[(i - 1) * elemSize + b]) : 0;
+        const unsigned d = x - prev - borrow;
+        dst[i * elemSize + b] = char(d & 0xFF);
+        borrow = (d >> 8) & 1;
+      }
+    }
+  }
+  std::memcpy(dst + n * elemSize, src + n * elemSize, nbytes - n * elemSize);
+}
+
+inline void DeltaFilter::decode(const char* src, char* dst,
+                                size_t nbytes, size_t elemSize) noexcept {
+  const size_t n = nbytes / elemSize;
+  if (details::is_little_endian() && elemSize == 1) {
+    details::delta_decode_fixed<uint8_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 2) {
+    details::delta_decode_fixed<uint16_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 4) {
+    details::delta_decode_fixed<uint32_t>(src, dst, n);
+  } else if (details::is_little_endian() && elemSize == 8) {
+    details::delta_decode_fixed<uint64_t>(src, dst, n);
+  } else {
+    // addition with carry, least significant byte first
+    for (size_t i = 0; i < n; i++) {
+      unsigned carry = 0;
+      for (size_t b = 0; b < elemSize; b++) {
+        const unsigned d = static_cast<unsigned char>(src[i * elemSize + b]);
+        const unsigned prev = i > 0 ?
+              static_cast<unsigned char>(dst[(i - 1) * elemSize + b]) : 0;
+        const unsigned x = d + prev + carry;
+        dst[i * elemSize + b] = char(x & 0xFF);
+        carry = x >> 8;
+      }
+    }
+  }
+  std::memcpy(dst + n * elemSize, src + n * elemSize, nbytes - n * elemSize);
+}
+
+inline void registerFilter(const H5Z_class2_t& filterClass) {
+  if (H5Zregister(&filterClass) < 0) {
+    HDF5ErrMapper::ToException<FilterException>(
+          std::string("Unable to register filter ") +
+          (filterClass.name ? filterClass.name : std::to_string(filterClass.id)));
+  }
+}
+
+template <typename Codec>
+inline void registerFilter() {
+  H5Z_class2_t filterClass;
+  filterClass.version = H5Z_CLASS_T_VERS;
+  filterClass.id = Codec::id;
+  filterClass.encoder_present = 1;
+  filterClass.decoder_present = 1;
+  filterClass.name = Codec::name();
+  filterClass.can_apply = NULL;
+  filterClass.set_local = &details::codec_set_local<Codec>;
+  filterClass.filter = &details::codec_filter<Codec>;
+  registerFilter(filterClass);
+}
+
+inline void unregisterFilter(H5Z_filter_t id) {
+  if (H5Zunregister(id) < 0) {
+    HDF5ErrMapper::ToException<FilterException>(
+          "Unable to unregister filter " + std::to_string(id));
+  }
+}
+
+inline bool isFilterAvailable(H5Z_filter_t id) {
+  htri_t avail = H5Zfilter_avail(id);
+  if (avail < 0) {
+    HDF5ErrMapper::ToException<FilterException>(
+          "Unable to check availability of filter " + std::to_string(id));
+  }
+  return avail > 0;
+}
+
+inline unsigned getFilterConfig(H5Z_filter_t id) {
+  unsigned config = 0;
+  if (H5Zget_filter_info(id, &config) < 0) {
+    HDF5ErrMapper::ToException<FilterException>(
+          "Unable to get info of filter " + std::to_string(id));
+  }
+  return config;
+}
+
+}  // namespace h5gt
+
+#endif // H5FILTER_MISC_HPP
@@ -0,0 +1,174 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5MACROS_HPP
+#define H5MACROS_HPP
+
+// Preprocessor helpers used by `H5GT_REFLECT`: applying a macro to each
+// element of __VA_ARGS__ (up to 128 elements)
+
+#define H5GT_PP_EXPAND(x) x
+#define H5GT_PP_CONCAT_(a, b) a##b
+#define H5GT_PP_CONCAT(a, b) H5GT_PP_CONCAT_(a, b)
+
+// number of arguments
+#define H5GT_PP_NARG(...) \
+  H5GT_PP_EXPAND(H5GT_PP_ARG_N(__VA_ARGS__, H5GT_PP_RSEQ_N()))
+#define H5GT_PP_ARG_N(...) H5GT_PP_EXPAND(H5GT_PP_ARG_N_(__VA_ARGS__))
+#define H5GT_PP_ARG_N_( \
+  _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, \
+  _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, \
+  _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, \
+  _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, \
+  _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, \
+  _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, \
+  _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, \
+  _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, \
+  _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, \
+  _125, _126, _127, _128, N, ...) N
+#define H5GT_PP_RSEQ_N() \
+  128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, \
+  114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, \
+  100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, \
+  82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, \
+  64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, \
+  46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, \
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, \
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+
+// H5GT_PP_FOR_EACH(m, data, x1, x2, ...) expands to m(data, x1) m(data, x2) ...
+#define H5GT_PP_FOR_EACH(m, data, ...) \
+  H5GT_PP_EXPAND(H5GT_PP_CONCAT(H5GT_PP_FE_, H5GT_PP_NARG(__VA_ARGS__))(m, data, __VA_ARGS__))
+#define H5GT_PP_FE_1(m, d, x) m(d, x)
+#define H5GT_PP_FE_2(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_1(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_3(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_2(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_4(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_3(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_5(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_4(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_6(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_5(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_7(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_6(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_8(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_7(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_9(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_8(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_10(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_9(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_11(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_10(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_12(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_11(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_13(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_12(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_14(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_13(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_15(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_14(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_16(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_15(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_17(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_16(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_18(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_17(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_19(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_18(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_20(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_19(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_21(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_20(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_22(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_21(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_23(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_22(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_24(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_23(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_25(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_24(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_26(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_25(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_27(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_26(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_28(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_27(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_29(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_28(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_30(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_29(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_31(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_30(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_32(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_31(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_33(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_32(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_34(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_33(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_35(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_34(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_36(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_35(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_37(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_36(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_38(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_37(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_39(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_38(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_40(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_39(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_41(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_40(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_42(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_41(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_43(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_42(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_44(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_43(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_45(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_44(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_46(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_45(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_47(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_46(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_48(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_47(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_49(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_48(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_50(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_49(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_51(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_50(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_52(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_51(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_53(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_52(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_54(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_53(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_55(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_54(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_56(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_55(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_57(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_56(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_58(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_57(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_59(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_58(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_60(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_59(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_61(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_60(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_62(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_61(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_63(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_62(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_64(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_63(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_65(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_64(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_66(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_65(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_67(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_66(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_68(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_67(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_69(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_68(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_70(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_69(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_71(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_70(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_72(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_71(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_73(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_72(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_74(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_73(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_75(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_74(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_76(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_75(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_77(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_76(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_78(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_77(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_79(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_78(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_80(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_79(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_81(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_80(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_82(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_81(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_83(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_82(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_84(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_83(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_85(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_84(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_86(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_85(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_87(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_86(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_88(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_87(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_89(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_88(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_90(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_89(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_91(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_90(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_92(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_91(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_93(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_92(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_94(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_93(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_95(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_94(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_96(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_95(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_97(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_96(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_98(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_97(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_99(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_98(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_100(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_99(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_101(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_100(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_102(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_101(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_103(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_102(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_104(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_103(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_105(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_104(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_106(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_105(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_107(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_106(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_108(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_107(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_109(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_108(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_110(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_109(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_111(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_110(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_112(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_111(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_113(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_112(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_114(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_113(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_115(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_114(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_116(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_115(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_117(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_116(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_118(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_117(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_119(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_118(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_120(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_119(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_121(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_120(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_122(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_121(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_123(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_122(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_124(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_123(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_125(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_124(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_126(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_125(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_127(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_126(m, d, __VA_ARGS__))
+#define H5GT_PP_FE_128(m, d, x, ...) m(d, x) H5GT_PP_EXPAND(H5GT_PP_FE_127(m, d, __VA_ARGS__))
+
+#endif // H5MACROS_HPP
@@ -0,0 +1,87 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5MMAP_MISC_HPP
+#define H5MMAP_MISC_HPP
+
+#include <memory>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define H5GT_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace h5gt {
+
+namespace details {
+
+///
+/// \brief Read-only memory mapping of a byte range of a file
+///
+class MappedRegion {
+public:
+  MappedRegion(const MappedRegion&) = delete;
+  MappedRegion& operator=(const MappedRegion&) = delete;
+
+  ~MappedRegion() {
+#ifdef H5GT_HAS_MMAP
+    if (_base != nullptr)
+      munmap(_base, _length);
+#endif
+  }
+
+  /// \return nullptr if the region can't be mapped
+  static std::shared_ptr<MappedRegion> map(const std::string& filename,
+                                           size_t offset, size_t nbytes) {
+#ifdef H5GT_HAS_MMAP
+    if (nbytes == 0)
+      return nullptr;
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return nullptr;
+
+    // mapping offset must be a multiple of the page size
+    const size_t page = size_t(sysconf(_SC_PAGESIZE));
+    const size_t aligned = offset / page * page;
+    const size_t length = nbytes + (offset - aligned);
+    void* base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, off_t(aligned));
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if (base == MAP_FAILED)
+      return nullptr;
+
+    std::shared_ptr<MappedRegion> region(new MappedRegion());
+    region->_base = base;
+    region->_length = length;
+    region->_data = static_cast<const char*>(base) + (offset - aligned);
+    return region;
+#else
+    (void)filename; (void)offset; (void)nbytes;
+    return nullptr;
+#endif
+  }
+
+  const char* data() const noexcept {
+    return _data;
+  }
+
+private:
+  MappedRegion() = default;
+
+  void* _base = nullptr;
+  size_t _length = 0;
+  const char* _data = nullptr;
+};
+
+}  // namespace details
+
+}  // namespace h5gt
+
+#endif // H5MMAP_MISC_HPP
@@ -38,9 +38,9 @@ public:
   createDataSet(const std::string& dataset_name,
                 const DataSpace& space,
                 const DataType& type,
-                const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+                const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
   ///
   /// \brief createDataSet create a new dataset in the current file with a
@@ -56,9 +56,9 @@ public:
   DataSet
   createDataSet(const std::string& dataset_name,
                 const DataSpace& space,
-                const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+                const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
   ///
   /// \brief createDataSet create a new dataset in the current file and
@@ -74,22 +74,22 @@ public:
   DataSet
   createDataSet(const std::string& dataset_name,
                 const T& data,
-                const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+                const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
 
   template <std::size_t N>
   DataSet
   createDataSet(const std::string& dataset_name,
                 const FixedLenStringArray<N>& data,
-                const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+                const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+                const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
   DataType getDataType(
       const std::string& dtype_name,
-      const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps()) const ;
+      const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps::Default()) const ;
 
   ///
   /// \brief get an existing dataset in the current file
@@ -98,7 +98,7 @@ public:
   /// \return return the named dataset, or throw exception if not found
   DataSet getDataSet(
       const std::string& dataset_name,
-      const DataSetAccessProps& accessProps = DataSetAccessProps()) const;
+      const DataSetAccessProps& accessProps = DataSetAccessProps::Default()) const;
 
   ///
   /// \brief create a new group, and eventually intermediate groups
@@ -108,16 +108,16 @@ public:
   /// \param groupAccessProps A group property list with data set access properties
   /// \return the group object
   Group createGroup(const std::string& group_name,
-                    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                    const GroupCreateProps& groupCreateProps = GroupCreateProps(),
-                    const GroupAccessProps& groupAccessProps = GroupAccessProps());
+                    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                    const GroupCreateProps& groupCreateProps = GroupCreateProps::Default(),
+                    const GroupAccessProps& groupAccessProps = GroupAccessProps::Default());
 
   ///
   /// \brief open an existing group with the name group_name
   /// \param group_name
   /// \return the group object
   Group getGroup(const std::string& group_name,
-                 const GroupAccessProps& groupAccessProps = GroupAccessProps()) const;
+                 const GroupAccessProps& groupAccessProps = GroupAccessProps::Default()) const;
 
   File getFile() const;
 
@@ -130,7 +130,7 @@ public:
   /// \brief return the name of the object with the given index
   /// \param linkCreateProps A link property list with data set creation properties
   /// \return the name of the object
-  std::string getObjectName(size_t index, const LinkAccessProps& linkAccessProps = LinkAccessProps()) const;
+  std::string getObjectName(size_t index, const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const;
 
   LinkInfo getLinkInfo(const std::string& objName) const;
 
@@ -158,8 +158,8 @@ public:
   /// \return boolean that is true if the move was successful
   bool rename(const std::string& src_path,
               const std::string& dest_path,
-              const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-              const LinkAccessProps& linkAccessProps = LinkAccessProps()) const;
+              const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+              const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const;
 
   ///
   /// \brief list all leaf objects name of the node / group
@@ -172,7 +172,7 @@ public:
   /// \param linkAccessProps A link property list with data set access properties
   /// \return true if a dataset/group with the associated name exists, or false
   bool exist(const std::string& obj_name,
-             const LinkAccessProps& linkAccessProps = LinkAccessProps(),
+             const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
              bool raise_errors = false) const;
 
   ///
@@ -183,37 +183,37 @@ public:
   /// \param raise_errors
   /// \return
   bool resolved(const std::string& obj_name,
-                const LinkAccessProps& linkAccessProps = LinkAccessProps(),
+                const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
                 bool raise_errors = false) const;
 
   ///
   /// \brief existAndResolved invokes `exist()` and then `reoslved()`
   bool existAndResolved(const std::string& obj_name,
-                        const LinkAccessProps& linkAccessProps = LinkAccessProps(),
+                        const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
                         bool raise_errors = false) const;
 
   bool hasObject(const std::string& objName, const ObjectType& objType,
-                 const LinkAccessProps& linkAccessProps = LinkAccessProps(),
+                 const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
                  bool raise_errors = false) const;
 
   ///
   /// \brief unlink the given dataset or group
   /// \param obj_name dataset/group name to unlink
   /// \param linkAccessProps A link property list with data set access properties
-  void unlink(const std::string& obj_name, const LinkAccessProps& linkAccessProps = LinkAccessProps()) const;
+  void unlink(const std::string& obj_name, const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const;
 
   ///
   /// \brief Returns the kind of link of the given name (soft, hard...)
   /// \param obj_name The entry to check, path relative to the current group
   /// \param linkAccessProps A link property list with data set access properties
   LinkType getLinkType(const std::string& obj_name,
-                       const LinkAccessProps& linkAccessProps = LinkAccessProps()) const;
+                       const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()) const;
 
   ///
   /// \brief A shorthand to get the kind of object pointed to (group, dataset, type...)
   /// \param obj_name The entry to check, path relative to the current group
   /// \param linkAccessProps A link property list with data set access properties
-  inline ObjectType getObjectType(const std::string& obj_name, const LinkAccessProps& accessProps = LinkAccessProps()) const;
+  inline ObjectType getObjectType(const std::string& obj_name, const LinkAccessProps& accessProps = LinkAccessProps::Default()) const;
 
 
   ///
@@ -221,20 +221,20 @@ public:
   /// The destination must not already have the object with the same name (objNewName).
   /// \return Copied object
   Group copy(const Group& obj, const std::string& objNewName,
-             const ObjectCopyProps& copyProps = ObjectCopyProps(),
-             const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-             const GroupAccessProps& groupAccessProps = GroupAccessProps());
+             const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+             const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+             const GroupAccessProps& groupAccessProps = GroupAccessProps::Default());
 
   DataSet copy(const DataSet& obj, const std::string& objNewName,
-               const ObjectCopyProps& copyProps = ObjectCopyProps(),
-               const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-               const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+               const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+               const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+               const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
   /// Copies commited datatype
   DataType copy(const DataType& obj, const std::string& objNewName,
-                const ObjectCopyProps& copyProps = ObjectCopyProps(),
-                const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-                const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps());
+                const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+                const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+                const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps::Default());
 
   template<typename Node,
            typename std::enable_if<
@@ -245,27 +245,27 @@ public:
       const std::string& linkName,
       const LinkType& linkType,
       const std::string& targetPath = "",
-      const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-      const LinkAccessProps& linkAccessProps = LinkAccessProps(),
-      const GroupAccessProps& groupAccessProps = GroupAccessProps());
+      const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+      const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
+      const GroupAccessProps& groupAccessProps = GroupAccessProps::Default());
 
   DataSet createLink(
       const DataSet& target,
       const std::string& linkName,
       const LinkType& linkType,
       const std::string& targetPath = "",
-      const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-      const LinkAccessProps& linkAccessProps = LinkAccessProps(),
-      const DataSetAccessProps& dsetAccessProps = DataSetAccessProps());
+      const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+      const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
+      const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default());
 
   DataType createLink(
       const DataType& target,
       const std::string& linkName,
       const LinkType& linkType,
       const std::string& targetPath = "",
-      const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-      const LinkAccessProps& linkAccessProps = LinkAccessProps(),
-      const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps());
+      const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+      const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
+      const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps::Default());
 
 private:
   typedef Derivate derivate_type;
@@ -274,21 +274,21 @@ private:
   // It makes behavior consistent among versions and by default transforms
   // errors to exceptions
   bool _exist(const std::string& node_name,
-              const LinkAccessProps& accessProps = LinkAccessProps(),
+              const LinkAccessProps& accessProps = LinkAccessProps::Default(),
               bool raise_errors = false) const;
 
   bool _resolved(const std::string& node_name,
-                 const LinkAccessProps& accessProps = LinkAccessProps(),
+                 const LinkAccessProps& accessProps = LinkAccessProps::Default(),
                  bool raise_errors = false) const;
 
   // Opens an arbitrary object to obtain info
   Object _open(const std::string& node_name,
-               const LinkAccessProps& accessProps = LinkAccessProps()) const;
+               const LinkAccessProps& accessProps = LinkAccessProps::Default()) const;
 
   template<typename T>
   void _copy(const T& obj, const std::string& newName,
-             const ObjectCopyProps& copyProps = ObjectCopyProps(),
-             const LinkCreateProps& linkCreateProps = LinkCreateProps());
+             const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+             const LinkCreateProps& linkCreateProps = LinkCreateProps::Default());
 
   /// targetPath is useful to create links using relative path
   template<typename T>
@@ -297,8 +297,8 @@ private:
       const std::string& linkName,
       const LinkType& linkType,
       std::string targetPath = "",
-      const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-      const LinkAccessProps& linkAccessProps = LinkAccessProps());
+      const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+      const LinkAccessProps& linkAccessProps = LinkAccessProps::Default());
 };
 
 
@@ -83,6 +83,345 @@ inline void PropertyList<T>::setExternalLinkPrefix(const std::string& prefix) {
   }
 }
 
+#if H5_VERSION_GE(1, 10, 1)
+inline void FileCreateProps::setFileSpaceStrategy(
+    const H5F_fspace_strategy_t& strategy,
+    const bool& persist,
+    const hsize_t& threshold)
+{
+  if (H5Pset_file_space_strategy(_hid, strategy, persist, threshold) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set file space strategy property");
+  }
+}
+
+inline void FileCreateProps::getFileSpaceStrategy(
+    H5F_fspace_strategy_t& strategy,
+    bool& persist,
+    hsize_t& threshold)
+{
+  hbool_t h5persist;
+  if (H5Pget_file_space_strategy(_hid, &strategy, &h5persist, &threshold) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get file space strategy property");
+  }
+  persist = h5persist;
+}
+
+inline H5F_fspace_strategy_t FileCreateProps::getFileSpaceStrategy()
+{
+  H5F_fspace_strategy_t strategy;
+  if (H5Pget_file_space_strategy(_hid, &strategy, NULL, NULL) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get file space strategy property");
+  }
+  return strategy;
+}
+
+inline void FileCreateProps::setFileSpacePageSize(const hsize_t& size)
+{
+  if (H5Pset_file_space_page_size(_hid, size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set file space page size property");
+  }
+}
+
+inline hsize_t FileCreateProps::getFileSpacePageSize()
+{
+  hsize_t size;
+  if (H5Pget_file_space_page_size(_hid, &size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get file space page size property");
+  }
+  return size;
+}
+
+inline void FileAccessProps::setPageBufferSize(
+    const size_t& size,
+    const unsigned& minMetaPerc,
+    const unsigned& minRawPerc)
+{
+  if (H5Pset_page_buffer_size(_hid, size, minMetaPerc, minRawPerc) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set page buffer size property");
+  }
+}
+
+inline void FileAccessProps::getPageBufferSize(
+    size_t& size,
+    unsigned& minMetaPerc,
+    unsigned& minRawPerc)
+{
+  if (H5Pget_page_buffer_size(_hid, &size, &minMetaPerc, &minRawPerc) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get page buffer size property");
+  }
+}
+
+inline size_t FileAccessProps::getPageBufferSize()
+{
+  size_t size;
+  if (H5Pget_page_buffer_size(_hid, &size, NULL, NULL) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get page buffer size property");
+  }
+  return size;
+}
+#endif
+
+inline void FileAccessProps::setAlignment(
+    const hsize_t& threshold, const hsize_t& alignment)
+{
+  if (H5Pset_alignment(_hid, threshold, alignment) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set alignment property");
+  }
+}
+
+inline void FileAccessProps::getAlignment(
+    hsize_t& threshold, hsize_t& alignment)
+{
+  if (H5Pget_alignment(_hid, &threshold, &alignment) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get alignment property");
+  }
+}
+
+inline void FileAccessProps::setMetaBlockSize(const hsize_t& size)
+{
+  if (H5Pset_meta_block_size(_hid, size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set metadata block size property");
+  }
+}
+
+inline hsize_t FileAccessProps::getMetaBlockSize()
+{
+  hsize_t size;
+  if (H5Pget_meta_block_size(_hid, &size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get metadata block size property");
+  }
+  return size;
+}
+
+inline void FileAccessProps::setSmallDataBlockSize(const hsize_t& size)
+{
+  if (H5Pset_small_data_block_size(_hid, size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set small data block size property");
+  }
+}
+
+inline hsize_t FileAccessProps::getSmallDataBlockSize()
+{
+  hsize_t size;
+  if (H5Pget_small_data_block_size(_hid, &size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get small data block size property");
+  }
+  return size;
+}
+
+inline void FileAccessProps::setSieveBufSize(const size_t& size)
+{
+  if (H5Pset_sieve_buf_size(_hid, size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set sieve buffer size property");
+  }
+}
+
+inline size_t FileAccessProps::getSieveBufSize()
+{
+  size_t size;
+  if (H5Pget_sieve_buf_size(_hid, &size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get sieve buffer size property");
+  }
+  return size;
+}
+
+inline void FileAccessProps::setLibverBounds(
+    const H5F_libver_t& low, const H5F_libver_t& high)
+{
+  if (H5Pset_libver_bounds(_hid, low, high) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set library version bounds property");
+  }
+}
+
+inline void FileAccessProps::getLibverBounds(
+    H5F_libver_t& low, H5F_libver_t& high)
+{
+  if (H5Pget_libver_bounds(_hid, &low, &high) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get library version bounds property");
+  }
+}
+
+inline void FileAccessProps::setMdcConfig(const H5AC_cache_config_t& config)
+{
+  H5AC_cache_config_t c = config;
+  c.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Pset_mdc_config(_hid, &c) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set metadata cache config property");
+  }
+}
+
+inline H5AC_cache_config_t FileAccessProps::getMdcConfig()
+{
+  H5AC_cache_config_t config;
+  config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Pget_mdc_config(_hid, &config) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get metadata cache config property");
+  }
+  return config;
+}
+
+inline void FileAccessProps::setMdcSize(
+    const size_t& initSize,
+    const size_t& minSize,
+    const size_t& maxSize)
+{
+  H5AC_cache_config_t config = getMdcConfig();
+  config.set_initial_size = true;
+  config.initial_size = initSize;
+  config.min_size = minSize;
+  config.max_size = maxSize;
+  setMdcConfig(config);
+}
+
+inline void FileAccessProps::getMdcSize(
+    size_t& initSize, size_t& minSize, size_t& maxSize)
+{
+  H5AC_cache_config_t config = getMdcConfig();
+  initSize = config.initial_size;
+  minSize = config.min_size;
+  maxSize = config.max_size;
+}
+
+inline void FileAccessProps::setMdcAutoResize(const bool& enable)
+{
+  H5AC_cache_config_t config = getMdcConfig();
+  if (enable){
+    config.incr_mode = H5C_incr__threshold;
+    config.flash_incr_mode = H5C_flash_incr__add_space;
+    config.decr_mode = H5C_decr__age_out_with_threshold;
+  } else {
+    config.incr_mode = H5C_incr__off;
+    config.flash_incr_mode = H5C_flash_incr__off;
+    config.decr_mode = H5C_decr__off;
+  }
+  setMdcConfig(config);
+}
+
+inline bool FileAccessProps::getMdcAutoResize()
+{
+  H5AC_cache_config_t config = getMdcConfig();
+  return config.incr_mode != H5C_incr__off ||
+      config.decr_mode != H5C_decr__off;
+}
+
+#if H5_VERSION_GE(1, 10, 1)
+inline void FileAccessProps::setMdcImageConfig(
+    const bool& generateImage,
+    const bool& saveResizeStatus,
+    const int& entryAgeout)
+{
+  H5AC_cache_image_config_t config;
+  config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+  config.generate_image = generateImage;
+  config.save_resize_status = saveResizeStatus;
+  config.entry_ageout = entryAgeout;
+  if (H5Pset_mdc_image_config(_hid, &config) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set metadata cache image config property");
+  }
+}
+
+inline void FileAccessProps::getMdcImageConfig(
+    bool& generateImage,
+    bool& saveResizeStatus,
+    int& entryAgeout)
+{
+  H5AC_cache_image_config_t config;
+  config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+  if (H5Pget_mdc_image_config(_hid, &config) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get metadata cache image config property");
+  }
+  generateImage = config.generate_image;
+  saveResizeStatus = config.save_resize_status;
+  entryAgeout = config.entry_ageout;
+}
+
+inline bool FileAccessProps::getMdcImageGenerate()
+{
+  bool generateImage, saveResizeStatus;
+  int entryAgeout;
+  getMdcImageConfig(generateImage, saveResizeStatus, entryAgeout);
+  return generateImage;
+}
+
+inline void FileAccessProps::setEvictOnClose(const bool& evict)
+{
+  if (H5Pset_evict_on_close(_hid, evict) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set evict on close property");
+  }
+}
+
+inline bool FileAccessProps::getEvictOnClose()
+{
+  hbool_t evict;
+  if (H5Pget_evict_on_close(_hid, &evict) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get evict on close property");
+  }
+  return evict;
+}
+#endif
+
+#ifdef H5GT_PARALLEL
+inline void FileAccessProps::setAllCollMetadataOps(const bool& enable)
+{
+  if (H5Pset_all_coll_metadata_ops(_hid, enable) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set collective metadata reads property");
+  }
+}
+
+inline bool FileAccessProps::getAllCollMetadataOps()
+{
+  hbool_t enable;
+  if (H5Pget_all_coll_metadata_ops(_hid, &enable) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get collective metadata reads property");
+  }
+  return enable;
+}
+
+inline void FileAccessProps::setCollMetadataWrite(const bool& enable)
+{
+  if (H5Pset_coll_metadata_write(_hid, enable) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set collective metadata write property");
+  }
+}
+
+inline bool FileAccessProps::getCollMetadataWrite()
+{
+  hbool_t enable;
+  if (H5Pget_coll_metadata_write(_hid, &enable) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get collective metadata write property");
+  }
+  return enable;
+}
+#endif
+
 inline void LinkCreateProps::setCreateIntermediateGroup(unsigned val) {
   if (H5Pset_create_intermediate_group(_hid, val) < 0){
     HDF5ErrMapper::ToException<PropertyException>(
@@ -108,6 +447,177 @@ inline void DataSetAccessProps::getChunkCache(
   }
 }
 
+inline void DataTransferProps::setBuffer(
+    const size_t& size, void* tconv, void* bkg)
+{
+  if (H5Pset_buffer(_hid, size, tconv, bkg) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set buffer property");
+  }
+}
+
+inline void DataTransferProps::getBuffer(
+    size_t& size, void*& tconv, void*& bkg)
+{
+  size = H5Pget_buffer(_hid, &tconv, &bkg);
+  if (size == 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get buffer property");
+  }
+}
+
+inline size_t DataTransferProps::getBufferSize()
+{
+  size_t size = H5Pget_buffer(_hid, NULL, NULL);
+  if (size == 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get buffer property");
+  }
+  return size;
+}
+
+inline void DataTransferProps::setHyperVectorSize(const size_t& size)
+{
+  if (H5Pset_hyper_vector_size(_hid, size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set hyper vector size property");
+  }
+}
+
+inline size_t DataTransferProps::getHyperVectorSize()
+{
+  size_t size;
+  if (H5Pget_hyper_vector_size(_hid, &size) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get hyper vector size property");
+  }
+  return size;
+}
+
+inline void DataTransferProps::setEDCCheck(const bool& enable)
+{
+  if (H5Pset_edc_check(_hid, enable ? H5Z_ENABLE_EDC : H5Z_DISABLE_EDC) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set EDC check property");
+  }
+}
+
+inline bool DataTransferProps::getEDCCheck()
+{
+  H5Z_EDC_t check = H5Pget_edc_check(_hid);
+  if (check == H5Z_ERROR_EDC){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get EDC check property");
+  }
+  return check == H5Z_ENABLE_EDC;
+}
+
+inline void DataTransferProps::setDataTransform(const std::string& expression)
+{
+  if (H5Pset_data_transform(_hid, expression.c_str()) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set data transform property");
+  }
+}
+
+inline std::string DataTransferProps::getDataTransform()
+{
+  ssize_t length;
+  {
+    // HDF5 raises an error if the expression has not been set
+    SilenceHDF5 silencer;
+    length = H5Pget_data_transform(_hid, NULL, 0);
+  }
+  if (length <= 0)
+    return std::string();
+
+  std::vector<char> buffer(length + 1, 0);
+  H5Pget_data_transform(_hid, buffer.data(), buffer.size());
+  return std::string(buffer.data(), length);
+}
+
+#ifdef H5GT_PARALLEL
+inline void DataTransferProps::setMpioTransferMode(const H5FD_mpio_xfer_t& mode)
+{
+  if (H5Pset_dxpl_mpio(_hid, mode) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set MPI-IO transfer mode property");
+  }
+}
+
+inline H5FD_mpio_xfer_t DataTransferProps::getMpioTransferMode()
+{
+  H5FD_mpio_xfer_t mode;
+  if (H5Pget_dxpl_mpio(_hid, &mode) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get MPI-IO transfer mode property");
+  }
+  return mode;
+}
+
+inline void DataTransferProps::setMpioCollectiveOpt(
+    const H5FD_mpio_collective_opt_t& opt)
+{
+  if (H5Pset_dxpl_mpio_collective_opt(_hid, opt) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set MPI-IO collective optimization property");
+  }
+}
+
+inline void DataTransferProps::setMpioChunkOpt(const H5FD_mpio_chunk_opt_t& opt)
+{
+  if (H5Pset_dxpl_mpio_chunk_opt(_hid, opt) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set MPI-IO chunk optimization property");
+  }
+}
+
+inline void DataTransferProps::setMpioChunkOptNum(const unsigned& numChunkPerProc)
+{
+  if (H5Pset_dxpl_mpio_chunk_opt_num(_hid, numChunkPerProc) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set MPI-IO chunk optimization threshold property");
+  }
+}
+
+inline void DataTransferProps::setMpioChunkOptRatio(const unsigned& percentProcPerChunk)
+{
+  if (H5Pset_dxpl_mpio_chunk_opt_ratio(_hid, percentProcPerChunk) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set MPI-IO chunk optimization ratio property");
+  }
+}
+
+inline H5D_mpio_actual_io_mode_t DataTransferProps::getMpioActualIoMode()
+{
+  H5D_mpio_actual_io_mode_t mode;
+  if (H5Pget_mpio_actual_io_mode(_hid, &mode) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get MPI-IO actual I/O mode");
+  }
+  return mode;
+}
+
+inline H5D_mpio_actual_chunk_opt_mode_t DataTransferProps::getMpioActualChunkOptMode()
+{
+  H5D_mpio_actual_chunk_opt_mode_t mode;
+  if (H5Pget_mpio_actual_chunk_opt_mode(_hid, &mode) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get MPI-IO actual chunk optimization mode");
+  }
+  return mode;
+}
+
+inline void DataTransferProps::getMpioNoCollectiveCause(
+    uint32_t& localCause, uint32_t& globalCause)
+{
+  if (H5Pget_mpio_no_collective_cause(_hid, &localCause, &globalCause) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get MPI-IO no collective cause");
+  }
+}
+#endif
+
 inline void DataSetCreateProps::addExternalFile(const std::string& file, off_t offset, hsize_t size)
 {
   if (size == 0){
@@ -150,7 +660,7 @@ inline void DataSetCreateProps::setShuffle() {
 }
 
 inline void DataSetCreateProps::setDeflate(const unsigned& level) {
-  if (!H5Zfilter_avail(H5Z_FILTER_SHUFFLE)){
+  if (!H5Zfilter_avail(H5Z_FILTER_DEFLATE)){
     HDF5ErrMapper::ToException<PropertyException>(
           "Z-FILTER is unavailable");
   }
@@ -161,6 +671,147 @@ inline void DataSetCreateProps::setDeflate(const unsigned& level) {
   }
 }
 
+inline void DataSetCreateProps::setFilter(
+    const H5Z_filter_t& id,
+    const unsigned& flags,
+    const std::vector<unsigned>& cdValues) {
+  if (flags == H5Z_FLAG_MANDATORY && !H5Zfilter_avail(id)){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Z-FILTER " + std::to_string(id) + " is unavailable");
+  }
+
+  if (H5Pset_filter(_hid, id, flags, cdValues.size(), cdValues.data()) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set filter " + std::to_string(id));
+  }
+}
+
+inline void DataSetCreateProps::setScaleOffset(
+    const H5Z_SO_scale_type_t& scaleType, const int& scaleFactor) {
+  if (!H5Zfilter_avail(H5Z_FILTER_SCALEOFFSET)){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Z-FILTER is unavailable");
+  }
+
+  if (H5Pset_scaleoffset(_hid, scaleType, scaleFactor) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set scale-offset property");
+  }
+}
+
+inline void DataSetCreateProps::setNBit() {
+  if (!H5Zfilter_avail(H5Z_FILTER_NBIT)){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Z-FILTER is unavailable");
+  }
+
+  if (H5Pset_nbit(_hid) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set n-bit property");
+  }
+}
+
+inline void DataSetCreateProps::setFletcher32() {
+  if (!H5Zfilter_avail(H5Z_FILTER_FLETCHER32)){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Z-FILTER is unavailable");
+  }
+
+  if (H5Pset_fletcher32(_hid) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set fletcher32 property");
+  }
+}
+
+inline void DataSetCreateProps::removeFilter(const H5Z_filter_t& id) {
+  if (H5Premove_filter(_hid, id) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to remove filter " + std::to_string(id));
+  }
+}
+
+inline size_t DataSetCreateProps::getFilterCount() {
+  int n = H5Pget_nfilters(_hid);
+  if (n < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get number of filters");
+  }
+  return size_t(n);
+}
+
+inline std::vector<FilterInfo> DataSetCreateProps::getFilters() {
+  const size_t n = getFilterCount();
+  std::vector<FilterInfo> filters(n);
+  for (size_t idx = 0; idx < n; idx++){
+    FilterInfo& info = filters[idx];
+    size_t cd_nelmts = 0;
+    // query the number of values first
+    if (H5Pget_filter2(_hid, unsigned(idx), &info.flags, &cd_nelmts,
+                       NULL, 0, NULL, NULL) < 0){
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get filter " + std::to_string(idx));
+    }
+
+    char name[256];
+    info.cd_values.resize(cd_nelmts);
+    info.id = H5Pget_filter2(_hid, unsigned(idx), &info.flags, &cd_nelmts,
+                             info.cd_values.data(), sizeof(name), name, NULL);
+    if (info.id < 0){
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get filter " + std::to_string(idx));
+    }
+    name[sizeof(name) - 1] = '\0';
+    info.name = name;
+
+    // filter of existing dataset may be not registered
+    if (H5Zfilter_avail(info.id) > 0 &&
+        H5Zget_filter_info(info.id, &info.filter_config) < 0){
+      HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get filter info " + std::to_string(info.id));
+    }
+  }
+  return filters;
+}
+
+inline bool DataSetCreateProps::hasFilter(const H5Z_filter_t& id) {
+  for (const auto& filter : getFilters())
+    if (filter.getId() == id)
+      return true;
+  return false;
+}
+
+inline void DataSetCreateProps::setAllocTime(const H5D_alloc_time_t& allocTime) {
+  if (H5Pset_alloc_time(_hid, allocTime) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set allocation time property");
+  }
+}
+
+inline H5D_alloc_time_t DataSetCreateProps::getAllocTime() {
+  H5D_alloc_time_t allocTime;
+  if (H5Pget_alloc_time(_hid, &allocTime) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get allocation time property");
+  }
+  return allocTime;
+}
+
+inline void DataSetCreateProps::setFillTime(const H5D_fill_time_t& fillTime) {
+  if (H5Pset_fill_time(_hid, fillTime) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set fill time property");
+  }
+}
+
+inline H5D_fill_time_t DataSetCreateProps::getFillTime() {
+  H5D_fill_time_t fillTime;
+  if (H5Pget_fill_time(_hid, &fillTime) < 0){
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to get fill time property");
+  }
+  return fillTime;
+}
+
 inline void DataSetCreateProps::setChunk(const std::vector<hsize_t>& dims) {
   if (H5Pset_chunk(_hid, static_cast<int>(dims.size()), dims.data()) < 0){
     HDF5ErrMapper::ToException<PropertyException>(
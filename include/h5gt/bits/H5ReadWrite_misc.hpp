@@ -45,7 +45,7 @@ struct string_type_checker<void> {
 template <std::size_t FixedLen>
 struct string_type_checker<char[FixedLen]> {
   inline static DataType getDataType(const DataType& element_type, bool ds_fixed_str) {
-    return ds_fixed_str ? AtomicType<char[FixedLen]>() : element_type;
+    return ds_fixed_str ? DataTypeRegistry::get<char[FixedLen]>() : element_type;
   }
 };
 
@@ -54,7 +54,7 @@ struct string_type_checker<char*> {
   inline static DataType getDataType(const DataType&, bool ds_fixed_str) {
     if (ds_fixed_str)
       throw DataSetException("Can't output variable-length to fixed-length strings");
-    return AtomicType<std::string>();
+    return DataTypeRegistry::get<std::string>();
   }
 };
 
@@ -74,7 +74,7 @@ BufferInfo<T>::BufferInfo(const DataType& dtype)
   , n_dimensions(details::inspector<type_no_const>::recursive_ndim -
                  ((is_fixed_len_string && is_char_array) ? 1 : 0))
   , data_type(string_type_checker<char_array_t>::getDataType(
-                create_datatype<elem_type>(), is_fixed_len_string)) {
+                DataTypeRegistry::get<elem_type>(), is_fixed_len_string)) {
   if (is_fixed_len_string && std::is_same<elem_type, std::string>::value) {
     throw DataSetException("Can't output std::string as fixed-length. "
                                "Use raw arrays or FixedLenStringArray");
@@ -17,6 +17,18 @@ inline Selection::Selection(const DataSpace& memspace,
   , _file_space(file_space)
   , _set(set) {}
 
+inline Selection::Selection(const DataSpace& memspace,
+                            const DataSpace& file_space, const DataSet& set,
+                            const DataSpace& io_memspace,
+                            const std::vector<size_t>& perm,
+                            size_t axis)
+  : _mem_space(memspace)
+  , _file_space(file_space)
+  , _io_mem_space(io_memspace)
+  , _set(set)
+  , _perm(perm)
+  , _perm_axis(axis) {}
+
 inline DataSpace Selection::getSpace() const noexcept {
   return _file_space;
 }
@@ -10,6 +10,8 @@
 #define H5SLICE_TRAITS_HPP
 
 #include <cstdlib>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "H5_definitions.hpp"
@@ -49,6 +51,52 @@ private:
   friend class SliceTraits;
 };
 
+///
+/// \brief Set of indices along one dimension (i.e. rows or columns).
+///
+/// Indices are sorted and deduplicated, consecutive runs and regular strides
+/// are coalesced into hyperslab blocks so that the selection is made with
+/// a few `H5Sselect_hyperslab` calls instead of one call per index.
+/// The original order of indices (duplicates included) is kept as
+/// a permutation that is applied in memory during read/write.
+class IndexSet {
+public:
+  ///
+  /// \brief Hyperslab block along one dimension: `count` blocks of `block`
+  /// elements separated by `stride` and starting from `start`
+  struct Block {
+    size_t start;
+    size_t stride;
+    size_t count;
+    size_t block;
+  };
+
+  explicit IndexSet(const std::vector<size_t>& ind);
+
+  ///
+  /// \brief Number of indices given by the user (duplicates included)
+  size_t size() const noexcept;
+
+  ///
+  /// \brief Sorted unique indices
+  const std::vector<size_t>& getUniqueIndices() const noexcept;
+
+  ///
+  /// \brief Coalesced hyperslab blocks (sorted by `start`)
+  const std::vector<Block>& getBlocks() const noexcept;
+
+  ///
+  /// \brief For each of the original indices its position in the
+  /// unique indices. Empty if the original indices are sorted and unique
+  const std::vector<size_t>& getPermutation() const noexcept;
+
+private:
+  std::vector<size_t> _unique;
+  std::vector<size_t> _perm;
+  std::vector<Block> _blocks;
+  size_t _size;
+};
+
 
 template <typename Derivate>
 class SliceTraits {
@@ -64,24 +112,41 @@ public:
                    const std::vector<size_t>& block = std::vector<size_t>()) const;
 
   /// \brief Select a region in the current Slice/Dataset out of a list of elements.
+  /// For one dimensional datasets unique elements are selected as
+  /// coalesced hyperslabs (see IndexSet)
   Selection select(const ElementSet& elements) const;
 
   /// \brief Select a set of rows in the first dimension of this dataset.
-  /// NOTE: Selection is done in memory layout order (be careful with chunked dsets).
-  /// Most likely the order of rows read will be mixed.
+  /// Rows are selected as coalesced hyperslabs (see IndexSet) and
+  /// are read/written in the order given by `ind` (duplicates allowed).
   /// \param ind row indices
   /// \param offset offset along each row (1 dim): 0-from the beginning
   /// \param count number of elements along each row (1 dim): 0-whole row starting from the offset
   Selection select_rows(const std::vector<size_t>& ind, size_t offset = 0, size_t count = 0) const;
 
   /// \brief Select a set of columns in the last dimension of this dataset.
-  /// NOTE: Selection is done in memory layout order (be careful with chunked dsets).
-  /// Most likely the order of rows read will be mixed.
+  /// Columns are selected as coalesced hyperslabs (see IndexSet) and
+  /// are read/written in the order given by `ind` (duplicates allowed).
   /// \param ind col indices
   /// \param offset along each column (0 dim): 0-from the beginning
   /// \param count number of elements along each column (0 dim): 0-whole column starting from the offset
   Selection select_cols(const std::vector<size_t>& ind, size_t offset = 0, size_t count = 0) const;
 
+  /// \brief Select indices `ind` along `axis` and `count` elements separated
+  /// by `stride` starting from `offset` along other dimensions
+  /// (values at `axis` are ignored).
+  /// Indices are selected as coalesced hyperslabs (see IndexSet) and
+  /// are read/written in the given order (duplicates allowed).
+  /// \param axis dimension of `ind`
+  /// \param ind indices along `axis`
+  /// \param offset offset of each dimension
+  /// \param count number of elements of each dimension
+  /// \param stride step of each dimension (1 if empty)
+  Selection select_along(size_t axis, const std::vector<size_t>& ind,
+                         const std::vector<size_t>& offset,
+                         const std::vector<size_t>& count,
+                         const std::vector<size_t>& stride = std::vector<size_t>()) const;
+
   /// Read the entire dataset into a buffer
   /// An exception is raised is if the numbers of dimension of the buffer and
   /// of the dataset are different.
@@ -89,8 +154,10 @@ public:
   /// not dimensionality checking will be performed, it is the user's
   /// responsibility to ensure that the right amount of space has been
   /// allocated.
+  /// \param xferProps: data transfer properties
   template <typename T>
-  void read(T& array) const;
+  void read(T& array,
+            const DataTransferProps& xferProps = DataTransferProps::Default()) const;
 
   /// Read the entire dataset into a raw buffer
   /// No dimensionality checks will be performed, it is the user's
@@ -98,16 +165,84 @@ public:
   /// allocated.
   /// \param array: A buffer containing enough space for the data
   /// \param dtype: The type of the data, in case it cannot be automatically guessed
+  /// \param xferProps: data transfer properties
+  template <typename T>
+  void read(T* array, const DataType& dtype = DataType(),
+            const DataTransferProps& xferProps = DataTransferProps::Default()) const;
+
+  /// Read the entire dataset/selection of strings (variable or fixed length)
+  /// to `table`. Variable length strings are allocated by HDF5 directly
+  /// in the table arena (grown as needed, its capacity is kept between reads)
+  /// \param table: strings in C order of the dataset/selection
+  /// \param xferProps: data transfer properties
+  void read(StringTable& table,
+            const DataTransferProps& xferProps = DataTransferProps::Default()) const;
+
+  /// Read the entire dataset/selection with multi-threaded decompression.
+  /// Chunks touched by the selection are fetched with `H5Dread_chunk`,
+  /// inflated/unshuffled by `nThreads` worker threads and scattered to
+  /// the buffer. Chunks that were never written are filled with the fill value.
+  /// The result is the same as after `read(array)` which is used
+  /// as a fallback if the dataset isn't chunked, the selection isn't a box,
+  /// memory datatype differs from the dataset datatype, the dataset uses
+  /// filters other than shuffle, deflate, `BitShuffleFilter` and `DeltaFilter`,
+  /// data transform is set or the file uses MPI-IO driver.
+  /// The array type can be any type supported by `read` (i.e. std::vector,
+  /// Eigen matrix)
+  /// \param nThreads number of worker threads (0 - number of hardware threads)
+  /// \param xferProps: data transfer properties
+  template <typename T>
+  void readParallel(T& array, size_t nThreads = 0,
+                    const DataTransferProps& xferProps = DataTransferProps::Default()) const;
+
+  /// Read the entire dataset/selection into a raw buffer with
+  /// multi-threaded decompression (see above)
+  /// \param array: A buffer containing enough space for the data
+  /// \param nThreads number of worker threads (0 - number of hardware threads)
+  /// \param dtype: The type of the data, in case it cannot be automatically guessed
+  /// \param xferProps: data transfer properties
   template <typename T>
-  void read(T* array, const DataType& dtype = DataType()) const;
+  void readParallel(T* array, size_t nThreads = 0, const DataType& dtype = DataType(),
+                    const DataTransferProps& xferProps = DataTransferProps::Default()) const;
+
+  /// \brief Read members `names` of compound dataset/selection as
+  /// struct-of-arrays: one contiguous vector per member.
+  /// Only the requested members are transferred: they are read with
+  /// packed compound memory type and scattered to the vectors.
+  /// Member types `T` must be trivially copyable (numbers, complex...)
+  /// \param names names of the members (one per `T`)
+  /// \param xferProps: data transfer properties
+  template <typename... T>
+  std::tuple<std::vector<T>...> readFields(
+      const std::vector<std::string>& names,
+      const DataTransferProps& xferProps = DataTransferProps::Default()) const;
+
+  /// \brief Write members `names` of compound dataset/selection from
+  /// struct-of-arrays (see `readFields`). Other members are left untouched
+  /// \param names names of the members (one per `T`)
+  /// \param columns one vector of selection size per member
+  /// \param xferProps: data transfer properties
+  template <typename... T>
+  void writeFields(const std::vector<std::string>& names,
+                   const std::tuple<std::vector<T>...>& columns,
+                   const DataTransferProps& xferProps = DataTransferProps::Default());
 
   /// Write the integrality N-dimension buffer to this dataset
   /// An exception is raised is if the numbers of dimension of the buffer and
   /// of the dataset are different
   /// The array type can be a N-pointer or a N-vector ( e.g int** integer two
   /// dimensional array )
+  /// \param xferProps: data transfer properties
   template <typename T>
-  void write(const T& buffer);
+  void write(const T& buffer,
+             const DataTransferProps& xferProps = DataTransferProps::Default());
+
+  /// Write strings of `table` as variable length strings.
+  /// An exception is raised if the number of strings differs from the
+  /// number of elements of the dataset/selection
+  /// \param xferProps: data transfer properties
+  void write(const StringTable& table,
+             const DataTransferProps& xferProps = DataTransferProps::Default());
 
   /// Write from a raw buffer into this dataset
   /// No dimensionality checks will be performed, it is the user's
@@ -116,9 +251,34 @@ public:
   /// default conventions.
   /// \param buffer: A buffer containing the data to be written
   /// \param dtype: The type of the data, in case it cannot be automatically guessed
+  /// \param xferProps: data transfer properties
   template <typename T>
-  void write_raw(const T* buffer, const DataType& dtype = DataType());
+  void write_raw(const T* buffer, const DataType& dtype = DataType(),
+                 const DataTransferProps& xferProps = DataTransferProps::Default());
+
+private:
+  /// \brief select `indices` along `axis` and `counts` elements separated
+  /// by `strides` (1 if empty) starting from `offsets` along other dimensions
+  Selection select_indices(const IndexSet& indices, size_t axis,
+                           const std::vector<hsize_t>& offsets,
+                           const std::vector<hsize_t>& counts,
+                           const std::vector<hsize_t>& strides = {}) const;
+
+  static const Selection* get_permuted(const Selection& sel) noexcept;
+  static const Selection* get_permuted(const DataSet&) noexcept;
 
+  static void read_permuted(const Selection& sel, void* array,
+                            const DataType& mem_datatype,
+                            const DataTransferProps& xferProps);
+  /// \brief read box selection chunk by chunk
+  /// \return false if the selection/dataset can't be read that way
+  static bool read_chunks(const DataSet& dset, const DataSpace& file_space,
+                          hid_t mem_space, void* array,
+                          const DataType& mem_datatype, size_t nThreads,
+                          const DataTransferProps& xferProps);
+  static void write_permuted(const Selection& sel, const void* buffer,
+                             const DataType& mem_datatype,
+                             const DataTransferProps& xferProps);
 };
 
 }  // namespace h5gt
@@ -11,10 +11,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #ifdef H5GT_USE_BOOST
 // starting Boost 1.64, serialization header must come before ublas
@@ -28,6 +32,7 @@
 
 #include "H5ReadWrite_misc.hpp"
 #include "H5Converter_misc.hpp"
+#include "H5Chunk_misc.hpp"
 
 namespace h5gt {
 
@@ -54,6 +59,127 @@ inline hid_t get_memspace_id(const Selection& ptr) {
 inline hid_t get_memspace_id(const DataSet&) {
   return H5S_ALL;
 }
+
+// select hyperslab blocks along `axis` and `counts` elements separated
+// by `strides` (1 if empty) starting from `offsets` along other dimensions
+template <typename It>
+inline DataSpace select_blocks(const DataSpace& space, It first, It last,
+                               size_t axis,
+                               const std::vector<hsize_t>& offsets,
+                               const std::vector<hsize_t>& counts,
+                               const std::vector<hsize_t>& strides) {
+  std::vector<hsize_t> offset_local(offsets);
+  std::vector<hsize_t> count_local(counts);
+  std::vector<hsize_t> stride_local(strides);
+  if (stride_local.empty())
+    stride_local.resize(counts.size(), 1);
+  std::vector<hsize_t> block_local(counts.size(), 1);
+
+  H5S_seloper_t op = H5S_SELECT_SET;
+  for (It b = first; b != last; ++b) {
+    offset_local[axis] = b->start;
+    stride_local[axis] = b->stride;
+    count_local[axis] = b->count;
+    block_local[axis] = b->block;
+
+    if (H5Sselect_hyperslab(space.getId(false), op, offset_local.data(),
+                            stride_local.data(), count_local.data(),
+                            block_local.data()) < 0) {
+      HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+    }
+    op = H5S_SELECT_OR;
+  }
+  return space;
+}
+
+// packed compound memory type of members `names` of types `types`
+// checked against compound `file_type`, member offsets are set to `offsets`
+inline CompoundType packed_compound_type(const DataType& file_type,
+                                         const std::vector<std::string>& names,
+                                         std::vector<DataType>&& types,
+                                         std::vector<size_t>& offsets) {
+  if (file_type.getClass() != DataTypeClass::Compound) {
+    throw DataTypeException("Members can only be selected from compound type, got: " +
+                            file_type.string());
+  }
+  if (names.size() != types.size()) {
+    throw DataTypeException("Number of member names (" + std::to_string(names.size()) +
+                            ") differs from number of member types (" +
+                            std::to_string(types.size()) + ")");
+  }
+
+  std::vector<CompoundType::member_def> members;
+  size_t size = 0;
+  offsets.clear();
+  for (size_t i = 0; i < names.size(); i++) {
+    if (H5Tget_member_index(file_type.getId(false), names[i].c_str()) < 0) {
+      throw DataTypeException("Compound type has no member: " + names[i]);
+    }
+    offsets.push_back(size);
+    members.emplace_back(names[i], std::move(types[i]), size);
+    size += members.back().base_type.getSize();
+  }
+  return CompoundType(std::move(members), size);
+}
+
+// copy members between packed records of `record_size` bytes and columns
+template <typename... T, size_t... I>
+inline void unpack_fields(const char* packed, size_t record_size,
+                          const std::vector<size_t>& offsets, size_t n,
+                          std::tuple<std::vector<T>...>& columns,
+                          std::index_sequence<I...>) {
+  auto unpack = [&](auto& column, size_t offset) {
+    column.resize(n);
+    for (size_t k = 0; k < n; k++)
+      std::memcpy(&column[k], packed + k * record_size + offset, sizeof(column[k]));
+  };
+  (unpack(std::get<I>(columns), offsets[I]), ...);
+}
+
+template <typename... T, size_t... I>
+inline void pack_fields(char* packed, size_t record_size,
+                        const std::vector<size_t>& offsets, size_t n,
+                        const std::tuple<std::vector<T>...>& columns,
+                        std::index_sequence<I...>) {
+  auto pack = [&](const auto& column, size_t offset) {
+    if (column.size() != n) {
+      throw DataSpaceException("Impossible to write column of " +
+                               std::to_string(column.size()) +
+                               " elements into selection of " +
+                               std::to_string(n) + " elements");
+    }
+    for (size_t k = 0; k < n; k++)
+      std::memcpy(packed + k * record_size + offset, &column[k], sizeof(column[k]));
+  };
+  (pack(std::get<I>(columns), offsets[I]), ...);
+}
+
+// copy rows/columns between `io` buffer of dimensions `io_dims` and
+// `mem` buffer that has `perm.size()` rows/columns along `axis`:
+// row/column `i` of `mem` is row/column `perm[i]` of `io`
+inline void permute_buffer(char* io, char* mem,
+                           const std::vector<size_t>& io_dims, size_t axis,
+                           const std::vector<size_t>& perm,
+                           size_t elem_size, bool io_to_mem) {
+  size_t outer = 1, inner = elem_size;
+  for (size_t i = 0; i < axis; i++)
+    outer *= io_dims[i];
+  for (size_t i = axis + 1; i < io_dims.size(); i++)
+    inner *= io_dims[i];
+
+  const size_t n_io = io_dims[axis];
+  const size_t n_mem = perm.size();
+  for (size_t o = 0; o < outer; o++) {
+    for (size_t i = 0; i < n_mem; i++) {
+      char* p_io = io + (o * n_io + perm[i]) * inner;
+      char* p_mem = mem + (o * n_mem + i) * inner;
+      if (io_to_mem)
+        std::memcpy(p_mem, p_io, inner);
+      else
+        std::memcpy(p_io, p_mem, inner);
+    }
+  }
+}
 }  // namespace details
 
 inline ElementSet::ElementSet(std::initializer_list<std::size_t> list)
@@ -71,6 +197,66 @@ inline ElementSet::ElementSet(const std::vector<std::vector<std::size_t>>& eleme
   }
 }
 
+inline IndexSet::IndexSet(const std::vector<size_t>& ind)
+  : _size(ind.size()) {
+  if (std::is_sorted(ind.begin(), ind.end()) &&
+      std::adjacent_find(ind.begin(), ind.end()) == ind.end()) {
+    _unique = ind;
+  } else {
+    std::vector<size_t> order(ind.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&ind](size_t a, size_t b){ return ind[a] < ind[b]; });
+
+    _perm.resize(ind.size());
+    for (const auto& i : order) {
+      if (_unique.empty() || _unique.back() != ind[i])
+        _unique.push_back(ind[i]);
+      _perm[i] = _unique.size() - 1;
+    }
+  }
+
+  // consecutive runs of indices: {start, length}
+  std::vector<std::pair<size_t, size_t>> runs;
+  for (const auto& i : _unique) {
+    if (!runs.empty() && runs.back().first + runs.back().second == i)
+      runs.back().second++;
+    else
+      runs.emplace_back(i, 1);
+  }
+
+  // runs of equal length separated by equal distance make a single block
+  for (const auto& run : runs) {
+    if (!_blocks.empty()) {
+      Block& b = _blocks.back();
+      size_t last = b.start + (b.count - 1) * b.stride;
+      if (b.block == run.second &&
+          (b.count == 1 || run.first - last == b.stride)) {
+        b.stride = run.first - last;
+        b.count++;
+        continue;
+      }
+    }
+    _blocks.push_back({run.first, run.second, 1, run.second});
+  }
+}
+
+inline size_t IndexSet::size() const noexcept {
+  return _size;
+}
+
+inline const std::vector<size_t>& IndexSet::getUniqueIndices() const noexcept {
+  return _unique;
+}
+
+inline const std::vector<IndexSet::Block>& IndexSet::getBlocks() const noexcept {
+  return _blocks;
+}
+
+inline const std::vector<size_t>& IndexSet::getPermutation() const noexcept {
+  return _perm;
+}
+
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& offset,
@@ -119,6 +305,15 @@ inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const
                                  "should be a multiple of the dimensions.");
   }
   const std::size_t num_elements = length / space.getNumberDimensions();
+
+  // point selection keeps duplicates in the given order thus only unique
+  // elements are coalesced
+  if (space.getNumberDimensions() == 1) {
+    IndexSet indices(elements._ids);
+    if (indices.getUniqueIndices().size() == indices.size())
+      return select_indices(indices, 0, {0}, {0});
+  }
+
   std::vector<hsize_t> raw_elements;
 
   // optimised at compile time
@@ -144,13 +339,8 @@ template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select_rows(
     const std::vector<size_t>& ind, size_t offset, size_t count) const {
   const auto& slice = static_cast<const Derivate&>(*this);
-  const DataSpace& space = slice.getSpace();
-  const DataSet& dataset = details::get_dataset(slice);
-  std::vector<size_t> dims = space.getDimensions();
-  dims[0] = ind.size();
-  std::vector<hsize_t> counts(dims.size());
-  std::copy(dims.begin(), dims.end(), counts.begin());
-  counts[0] = 1;
+  std::vector<size_t> dims = slice.getSpace().getDimensions();
+  std::vector<hsize_t> counts(dims.begin(), dims.end());
   std::vector<hsize_t> offsets(dims.size(), 0);
 
   if (offset != 0 && offsets.size() > 1){
@@ -162,34 +352,17 @@ inline Selection SliceTraits<Derivate>::select_rows(
 
   if (count != 0 && counts.size() > 1){
     counts[1] = count;
-    dims[1] = count;
-  }
-
-  H5Sselect_none(space.getId(false));
-
-  for (const auto& i : ind) {
-    offsets[0] = i;
-
-    if (H5Sselect_hyperslab(space.getId(false), H5S_SELECT_OR, offsets.data(), 0,
-                            counts.data(), 0) < 0) {
-      HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
-    }
   }
 
-  return Selection(DataSpace(dims), space, dataset);
+  return select_indices(IndexSet(ind), 0, offsets, counts);
 }
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select_cols(
     const std::vector<size_t>& ind, size_t offset, size_t count) const {
   const auto& slice = static_cast<const Derivate&>(*this);
-  const DataSpace& space = slice.getSpace();
-  const DataSet& dataset = details::get_dataset(slice);
-  std::vector<size_t> dims = space.getDimensions();
-  dims[dims.size() - 1] = ind.size();
-  std::vector<hsize_t> counts(dims.size());
-  std::copy(dims.begin(), dims.end(), counts.begin());
-  counts[dims.size() - 1] = 1;
+  std::vector<size_t> dims = slice.getSpace().getDimensions();
+  std::vector<hsize_t> counts(dims.begin(), dims.end());
   std::vector<hsize_t> offsets(dims.size(), 0);
 
   if (offset != 0 && offsets.size() > 0){
@@ -201,27 +374,269 @@ inline Selection SliceTraits<Derivate>::select_cols(
 
   if (count != 0 && counts.size() > 0){
     counts[0] = count;
-    dims[0] = count;
   }
 
+  return select_indices(IndexSet(ind), dims.size() - 1, offsets, counts);
+}
 
-  H5Sselect_none(space.getId(false));
+template <typename Derivate>
+inline Selection SliceTraits<Derivate>::select_along(
+    size_t axis, const std::vector<size_t>& ind,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const std::vector<size_t>& stride) const {
+  const auto& slice = static_cast<const Derivate&>(*this);
+  const size_t ndims = slice.getSpace().getNumberDimensions();
+  if (axis >= ndims || offset.size() != ndims || count.size() != ndims ||
+      (!stride.empty() && stride.size() != ndims)) {
+    throw DataSpaceException("Axis, offset, count and stride don't match "
+                             "the number of dimensions");
+  }
 
-  for (const auto& i : ind) {
-    offsets[offsets.size() - 1] = i;
+  return select_indices(IndexSet(ind), axis,
+                        std::vector<hsize_t>(offset.begin(), offset.end()),
+                        std::vector<hsize_t>(count.begin(), count.end()),
+                        std::vector<hsize_t>(stride.begin(), stride.end()));
+}
 
-    if (H5Sselect_hyperslab(space.getId(false), H5S_SELECT_OR, offsets.data(), 0,
-                            counts.data(), 0) < 0) {
-      HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+template <typename Derivate>
+inline Selection SliceTraits<Derivate>::select_indices(
+    const IndexSet& indices, size_t axis,
+    const std::vector<hsize_t>& offsets,
+    const std::vector<hsize_t>& counts,
+    const std::vector<hsize_t>& strides) const {
+  const auto& slice = static_cast<const Derivate&>(*this);
+  DataSpace space = slice.getSpace().clone();
+
+  const auto& blocks = indices.getBlocks();
+  if (blocks.empty())
+    H5Sselect_none(space.getId(false));
+
+  // `H5S_SELECT_OR` merges each block with the whole selection made
+  // so far thus many blocks are selected in groups that are then
+  // combined pairwise
+#if H5_VERSION_GE(1, 10, 6)
+  const size_t group_size = 32;
+#else
+  const size_t group_size = std::max(blocks.size(), size_t(1));
+#endif
+  std::vector<DataSpace> groups;
+  for (size_t first = 0; first < blocks.size(); first += group_size) {
+    size_t last = std::min(first + group_size, blocks.size());
+    groups.push_back(details::select_blocks(
+                       space.clone(), blocks.begin() + first, blocks.begin() + last,
+                       axis, offsets, counts, strides));
+  }
+
+#if H5_VERSION_GE(1, 10, 6)
+  while (groups.size() > 1) {
+    std::vector<DataSpace> merged;
+    for (size_t i = 0; i + 1 < groups.size(); i += 2) {
+      hid_t hid = H5Scombine_select(groups[i].getId(false), H5S_SELECT_OR,
+                                    groups[i + 1].getId(false));
+      if (hid < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to combine selections");
+      }
+      merged.push_back(DataSpace::FromId(hid));
     }
+    if (groups.size() % 2 != 0)
+      merged.push_back(groups.back());
+    groups = std::move(merged);
+  }
+#endif
+  if (!groups.empty())
+    space = groups[0];
+
+  std::vector<size_t> dims(counts.begin(), counts.end());
+  dims[axis] = indices.size();
+  if (indices.getPermutation().empty())
+    return Selection(DataSpace(dims), space, details::get_dataset(slice));
+
+  std::vector<size_t> io_dims(dims);
+  io_dims[axis] = indices.getUniqueIndices().size();
+  return Selection(DataSpace(dims), space, details::get_dataset(slice),
+                   DataSpace(io_dims), indices.getPermutation(), axis);
+}
+
+template <typename Derivate>
+inline const Selection* SliceTraits<Derivate>::get_permuted(
+    const Selection& sel) noexcept {
+  return sel._perm.empty() ? nullptr : &sel;
+}
+
+template <typename Derivate>
+inline const Selection* SliceTraits<Derivate>::get_permuted(
+    const DataSet&) noexcept {
+  return nullptr;
+}
+
+template <typename Derivate>
+inline void SliceTraits<Derivate>::read_permuted(
+    const Selection& sel, void* array, const DataType& mem_datatype,
+    const DataTransferProps& xferProps) {
+  const std::vector<size_t> dims = sel._io_mem_space.getDimensions();
+  const size_t n_unique = dims[sel._perm_axis];
+  // duplicated pointers to variable length data can't be reclaimed
+  if (sel._perm.size() > n_unique &&
+      (mem_datatype.isVariableStr() ||
+       H5Tdetect_class(mem_datatype.getId(false), H5T_VLEN) > 0)) {
+    throw DataSetException("Duplicated indices are not supported "
+                           "for variable length types");
+  }
+
+  const size_t elem_size = mem_datatype.getSize();
+  std::vector<char> buffer(sel._io_mem_space.getElementCount() * elem_size);
+  if (H5Dread(sel.getDataset().getId(false),
+              mem_datatype.getId(false),
+              sel._io_mem_space.getId(false),
+              sel.getSpace().getId(false), xferProps.getId(false),
+              static_cast<void*>(buffer.data())) < 0) {
+    HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
   }
 
-  return Selection(DataSpace(dims), space, dataset);
+  details::permute_buffer(
+        buffer.data(), static_cast<char*>(array), dims, sel._perm_axis,
+        sel._perm, elem_size, true);
+}
+
+template <typename Derivate>
+inline void SliceTraits<Derivate>::write_permuted(
+    const Selection& sel, const void* buffer, const DataType& mem_datatype,
+    const DataTransferProps& xferProps) {
+  const std::vector<size_t> dims = sel._io_mem_space.getDimensions();
+  const size_t elem_size = mem_datatype.getSize();
+  std::vector<char> io_buffer(sel._io_mem_space.getElementCount() * elem_size);
+
+  // for duplicated indices the last one is written
+  details::permute_buffer(
+        io_buffer.data(), const_cast<char*>(static_cast<const char*>(buffer)),
+        dims, sel._perm_axis, sel._perm, elem_size, false);
+
+  if (H5Dwrite(sel.getDataset().getId(false),
+               mem_datatype.getId(false),
+               sel._io_mem_space.getId(false),
+               sel.getSpace().getId(false), xferProps.getId(false),
+               static_cast<const void*>(io_buffer.data())) < 0) {
+    HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+  }
+}
+
+template <typename Derivate>
+inline bool SliceTraits<Derivate>::read_chunks(
+    const DataSet& dset, const DataSpace& file_space, hid_t mem_space,
+    void* array, const DataType& mem_datatype, size_t nThreads,
+    const DataTransferProps& xferProps) {
+#if H5_VERSION_GE(1, 10, 5)
+  // file selection must be a box read to contiguous memory
+  const size_t ndims = file_space.getNumberDimensions();
+  const hssize_t npoints = H5Sget_select_npoints(file_space.getId(false));
+  // point selection may be unordered
+  const H5S_sel_type sel_type = H5Sget_select_type(file_space.getId(false));
+  if (ndims == 0 || npoints <= 0 ||
+      (sel_type != H5S_SEL_ALL && sel_type != H5S_SEL_HYPERSLABS))
+    return false;
+
+  if (mem_space != H5S_ALL &&
+      (H5Sget_select_type(mem_space) != H5S_SEL_ALL ||
+       H5Sget_simple_extent_npoints(mem_space) != npoints))
+    return false;
+
+  std::vector<hsize_t> first(ndims), last(ndims);
+  if (H5Sget_select_bounds(file_space.getId(false), first.data(), last.data()) < 0)
+    return false;
+
+  std::vector<size_t> offset(ndims), count(ndims);
+  size_t volume = 1;
+  for (size_t d = 0; d < ndims; d++) {
+    offset[d] = first[d];
+    count[d] = last[d] - first[d] + 1;
+    volume *= count[d];
+  }
+  if (volume != size_t(npoints))
+    return false;
+
+  DataSetCreateProps createProps = dset.getCreateProps();
+  if (!createProps.isChunked() ||
+      mem_datatype.isVariableStr() ||
+      H5Tdetect_class(mem_datatype.getId(false), H5T_VLEN) > 0 ||
+      !details::vlen_string_offsets(mem_datatype).empty() ||
+      H5Tequal(mem_datatype.getId(false), dset.getDataType().getId(false)) <= 0 ||
+      details::has_data_transform(xferProps.getId(false)) ||
+      details::is_mpio_file(dset.getId(false)))
+    return false;
+
+  // partial edge chunks may be stored unfiltered
+  unsigned chunk_opts = 0;
+  if (H5Pget_chunk_opts(createProps.getId(false), &chunk_opts) < 0 ||
+      (chunk_opts & H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS))
+    return false;
+
+  const size_t elem_size = mem_datatype.getSize();
+  details::ChunkPipeline pipeline;
+  if (!pipeline.init(createProps.getId(false), elem_size))
+    return false;
+
+  std::vector<hsize_t> chunk = createProps.getChunk(int(ndims));
+  details::ChunkBox box(offset, count,
+                        std::vector<size_t>(chunk.begin(), chunk.end()));
+  const size_t chunk_bytes = box.chunkBytes(elem_size);
+  const std::vector<char> fill = details::get_fill_chunk(
+        createProps.getId(false), mem_datatype.getId(false),
+        elem_size, chunk_bytes);
+
+  nThreads = details::get_num_threads(nThreads);
+  const size_t window = 4 * nThreads;
+  std::vector<std::vector<char>> chunks(window);
+  std::vector<std::vector<hsize_t>> offsets(window);
+  std::vector<uint32_t> masks(window);
+  std::vector<char> allocated(window);
+  char* box_data = static_cast<char*>(array);
+
+  // HDF5 is called only from the calling thread
+  details::parallel_feed(
+        box.size(), nThreads, window,
+        [&](size_t i, size_t slot) {
+    offsets[slot] = box.chunkOffset(i);
+    unsigned filter_mask = 0;
+    haddr_t addr = HADDR_UNDEF;
+    hsize_t nbytes = 0;
+    if (H5Dget_chunk_info_by_coord(dset.getId(false), offsets[slot].data(),
+                                   &filter_mask, &addr, &nbytes) < 0) {
+      HDF5ErrMapper::ToException<DataSetException>("Unable to get chunk info");
+    }
+
+    allocated[slot] = addr != HADDR_UNDEF;
+    if (!allocated[slot])
+      return;
+
+    chunks[slot].resize(nbytes);
+    if (H5Dread_chunk(dset.getId(false), xferProps.getId(false),
+                      offsets[slot].data(), &masks[slot],
+                      chunks[slot].data()) < 0) {
+      HDF5ErrMapper::ToException<DataSetException>("Unable to read chunk");
+    }
+  },
+  [&](size_t, size_t slot) {
+    if (!allocated[slot]) {
+      box.copy(const_cast<char*>(fill.data()), box_data, offsets[slot],
+               elem_size, false);
+      return;
+    }
+    pipeline.decode(chunks[slot], chunk_bytes, masks[slot]);
+    box.copy(chunks[slot].data(), box_data, offsets[slot], elem_size, false);
+  });
+  return true;
+#else
+  (void)dset; (void)file_space; (void)mem_space; (void)array;
+  (void)mem_datatype; (void)nThreads; (void)xferProps;
+  return false;
+#endif
 }
 
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::read(T& array) const {
+inline void SliceTraits<Derivate>::readParallel(
+    T& array, size_t nThreads, const DataTransferProps& xferProps) const {
   const auto& slice = static_cast<const Derivate&>(*this);
   const DataSpace& mem_space = slice.getMemSpace();
   const details::BufferInfo<T> buffer_info(slice.getDataType());
@@ -234,10 +649,55 @@ inline void SliceTraits<Derivate>::read(T& array) const {
     throw DataSpaceException(ss.str());
   }
   details::data_converter<T> converter(mem_space, buffer_info.data_type);
-  if (buffer_info.data_type.getClass() == DataTypeClass::Compound){
-    
+  const auto& props =
+      details::converter_read_props<details::data_converter<T>>::get(converter, xferProps);
+  readParallel(converter.transform_read(array), nThreads,
+               buffer_info.data_type, props);
+  // re-arrange results
+  converter.process_result(array);
+}
+
+template <typename Derivate>
+template <typename T>
+inline void SliceTraits<Derivate>::readParallel(
+    T* array, size_t nThreads, const DataType& dtype,
+    const DataTransferProps& xferProps) const {
+  static_assert(!std::is_const<T>::value,
+      "readParallel() requires a non-const structure to read data into");
+  const auto& slice = static_cast<const Derivate&>(*this);
+  using element_type = typename details::inspector<T>::base_type;
+
+  const DataType& mem_datatype =
+      dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
+
+  if (get_permuted(slice) == nullptr &&
+      read_chunks(details::get_dataset(slice), slice.getSpace(),
+                  details::get_memspace_id(slice), static_cast<void*>(array),
+                  mem_datatype, nThreads, xferProps))
+    return;
+
+  read(array, mem_datatype, xferProps);
+}
+
+template <typename Derivate>
+template <typename T>
+inline void SliceTraits<Derivate>::read(
+    T& array, const DataTransferProps& xferProps) const {
+  const auto& slice = static_cast<const Derivate&>(*this);
+  const DataSpace& mem_space = slice.getMemSpace();
+  const details::BufferInfo<T> buffer_info(slice.getDataType());
+
+  if (!details::checkDimensions(mem_space, buffer_info.n_dimensions)) {
+    std::ostringstream ss;
+    ss << "Impossible to read DataSet of dimensions "
+           << mem_space.getNumberDimensions() << " into arrays of dimensions "
+           << buffer_info.n_dimensions;
+    throw DataSpaceException(ss.str());
   }
-  read(converter.transform_read(array), buffer_info.data_type);
+  details::data_converter<T> converter(mem_space, buffer_info.data_type);
+  const auto& props =
+      details::converter_read_props<details::data_converter<T>>::get(converter, xferProps);
+  read(converter.transform_read(array), buffer_info.data_type, props);
   // re-arrange results
   converter.process_result(array);
 }
@@ -251,7 +711,9 @@ template <typename T>
 /// to manually free allocated `const char *` memory (using H5Treclaim())
 /// \param array
 /// \param dtype
-inline void SliceTraits<Derivate>::read(T* array, const DataType& dtype) const {
+/// \param xferProps
+inline void SliceTraits<Derivate>::read(
+    T* array, const DataType& dtype, const DataTransferProps& xferProps) const {
   static_assert(!std::is_const<T>::value,
       "read() requires a non-const structure to read data into");
   const auto& slice = static_cast<const Derivate&>(*this);
@@ -261,18 +723,64 @@ inline void SliceTraits<Derivate>::read(T* array, const DataType& dtype) const {
   const DataType& mem_datatype =
       dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
 
+  if (const Selection* sel = get_permuted(slice)) {
+    read_permuted(*sel, static_cast<void*>(array), mem_datatype, xferProps);
+    return;
+  }
+
   if (H5Dread(details::get_dataset(slice).getId(false),
               mem_datatype.getId(false),
               details::get_memspace_id(slice),
-              slice.getSpace().getId(false), H5P_DEFAULT, static_cast<void*>(array)) < 0) {
+              slice.getSpace().getId(false), xferProps.getId(false),
+              static_cast<void*>(array)) < 0) {
     HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
   }
 }
 
 
+template <typename Derivate>
+inline void SliceTraits<Derivate>::read(
+    StringTable& table, const DataTransferProps& xferProps) const {
+  const auto& slice = static_cast<const Derivate&>(*this);
+  const size_t n = slice.getMemSpace().getElementCount();
+  const DataType file_datatype = slice.getDataType();
+
+  if (file_datatype.isFixedLenStr()) {
+    // fixed to variable length strings conversion isn't supported by HDF5
+    const size_t length = file_datatype.getSize();
+    std::vector<char> buffer(n * length);
+    read(buffer.data(), file_datatype, xferProps);
+    table.clear();
+    for (size_t i = 0; i < n; i++) {
+      const char* str = buffer.data() + i * length;
+      table.push_back(std::string_view(str, strnlen(str, length)));
+    }
+    return;
+  }
+
+  // don't modify user's property list
+  DataTransferProps props = xferProps.isDefault() ?
+        DataTransferProps() :
+        DataTransferProps::FromId(H5Pcopy(xferProps.getId(false)), false);
+
+  // 16 bytes per string for the first read
+  details::StringArena arena(table, n * 16);
+  if (H5Pset_vlen_mem_manager(props.getId(false),
+                              &details::StringArena::allocate, &arena,
+                              &details::StringArena::deallocate, &arena) < 0) {
+    HDF5ErrMapper::ToException<PropertyException>(
+          "Unable to set variable length memory manager");
+  }
+
+  std::vector<const char*> ptrs(n, nullptr);
+  read(ptrs.data(), AtomicType<std::string>(), props);
+  arena.finish(ptrs);
+}
+
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::write(const T& buffer) {
+inline void SliceTraits<Derivate>::write(
+    const T& buffer, const DataTransferProps& xferProps) {
   const auto& slice = static_cast<const Derivate&>(*this);
   const DataSpace& mem_space = slice.getMemSpace();
   const details::BufferInfo<T> buffer_info(slice.getDataType());
@@ -284,27 +792,95 @@ inline void SliceTraits<Derivate>::write(const T& buffer) {
     throw DataSpaceException(ss.str());
   }
   details::data_converter<T> converter(mem_space, buffer_info.data_type);
-  write_raw(converter.transform_write(buffer), buffer_info.data_type);
+  write_raw(converter.transform_write(buffer), buffer_info.data_type, xferProps);
 }
 
 
+template <typename Derivate>
+inline void SliceTraits<Derivate>::write(
+    const StringTable& table, const DataTransferProps& xferProps) {
+  const auto& slice = static_cast<const Derivate&>(*this);
+  const size_t n = slice.getMemSpace().getElementCount();
+  if (table.size() != n) {
+    throw DataSpaceException("Impossible to write " + std::to_string(table.size()) +
+                             " strings into selection of " +
+                             std::to_string(n) + " elements");
+  }
+  const std::vector<const char*> ptrs = table.getCStrings();
+  write_raw(ptrs.data(), AtomicType<std::string>(), xferProps);
+}
+
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::write_raw(const T* buffer, const DataType& dtype) {
+inline void SliceTraits<Derivate>::write_raw(
+    const T* buffer, const DataType& dtype, const DataTransferProps& xferProps) {
   using element_type = typename details::inspector<T>::base_type;
   const auto& slice = static_cast<const Derivate&>(*this);
   const auto& mem_datatype =
       dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
 
+  if (const Selection* sel = get_permuted(slice)) {
+    write_permuted(*sel, static_cast<const void*>(buffer), mem_datatype, xferProps);
+    return;
+  }
+
   if (H5Dwrite(details::get_dataset(slice).getId(false),
                mem_datatype.getId(false),
                details::get_memspace_id(slice),
-               slice.getSpace().getId(false), H5P_DEFAULT,
+               slice.getSpace().getId(false), xferProps.getId(false),
                static_cast<const void*>(buffer)) < 0) {
     HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
   }
 }
 
+template <typename Derivate>
+template <typename... T>
+inline std::tuple<std::vector<T>...> SliceTraits<Derivate>::readFields(
+    const std::vector<std::string>& names,
+    const DataTransferProps& xferProps) const {
+  static_assert(std::conjunction<std::is_trivially_copyable<T>...>::value,
+      "readFields() requires trivially copyable member types");
+  const auto& slice = static_cast<const Derivate&>(*this);
+
+  std::vector<size_t> offsets;
+  const CompoundType mem_datatype = details::packed_compound_type(
+        slice.getDataType(), names,
+        std::vector<DataType>{create_and_check_datatype<T>()...}, offsets);
+  const size_t record_size = mem_datatype.getSize();
+  const size_t n = slice.getMemSpace().getElementCount();
+
+  std::vector<char> packed(n * record_size);
+  read(packed.data(), mem_datatype, xferProps);
+
+  std::tuple<std::vector<T>...> columns;
+  details::unpack_fields(packed.data(), record_size, offsets, n, columns,
+                         std::index_sequence_for<T...>());
+  return columns;
+}
+
+template <typename Derivate>
+template <typename... T>
+inline void SliceTraits<Derivate>::writeFields(
+    const std::vector<std::string>& names,
+    const std::tuple<std::vector<T>...>& columns,
+    const DataTransferProps& xferProps) {
+  static_assert(std::conjunction<std::is_trivially_copyable<T>...>::value,
+      "writeFields() requires trivially copyable member types");
+  const auto& slice = static_cast<const Derivate&>(*this);
+
+  std::vector<size_t> offsets;
+  const CompoundType mem_datatype = details::packed_compound_type(
+        slice.getDataType(), names,
+        std::vector<DataType>{create_and_check_datatype<T>()...}, offsets);
+  const size_t record_size = mem_datatype.getSize();
+  const size_t n = slice.getMemSpace().getElementCount();
+
+  std::vector<char> packed(n * record_size);
+  details::pack_fields(packed.data(), record_size, offsets, n, columns,
+                       std::index_sequence_for<T...>());
+  write_raw(packed.data(), mem_datatype, xferProps);
+}
+
 }  // namespace h5gt
 
 #endif  // H5SLICE_TRAITS_MISC_HPP
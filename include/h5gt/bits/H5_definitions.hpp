@@ -45,6 +45,8 @@ class FixedLenStringArray;
 template <typename Derivate>
 class NodeTraits;
 
+class StringTable;
+
 template <PropertyType T>
 class PropertyList;
 
@@ -57,6 +59,8 @@ namespace details {
 template <typename T, typename Enable = void>
 struct data_converter;
 
+class StringArena;
+
 }
 
 }  // namespace h5gt
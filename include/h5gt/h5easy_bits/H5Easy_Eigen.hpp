@@ -92,18 +92,20 @@ struct io_impl<
     using value_type = typename std::decay<T>::type::Scalar;
     row_major_type row_major(data);
     DataSet dataset = initDataset<value_type>(file, path, shape(data), options);
-    dataset.write_raw(row_major.data());
+    dataset.write_raw(row_major.data(), DataType(), options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
     return dataset;
   }
 
-  inline static T load(const File& file, const std::string& path) {
+  inline static T load(const File& file,
+                       const std::string& path,
+                       const DataTransferProps& xferProps) {
     DataSet dataset = file.getDataSet(path);
     std::vector<typename T::Index> dims = shape(file, path, dataset, T::RowsAtCompileTime);
     T data(dims[0], dims[1]);
-    dataset.read(data.data());
+    dataset.read(data.data(), DataType(), xferProps);
     if (data.IsVectorAtCompileTime || data.IsRowMajor) {
       return data;
     }
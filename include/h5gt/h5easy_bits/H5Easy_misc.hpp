@@ -98,7 +98,7 @@ inline DataSet initDataset(File& file,
         props.setDeflate(options.getCompressionLevel());
       }
       return file.createDataSet<T>(
-            path, DataSpace(shape), LinkCreateProps(),
+            path, DataSpace(shape), LinkCreateProps::Default(),
             props);
     }
   } else if (options.overwrite() && file.getObjectType(path) == ObjectType::Dataset) {
@@ -55,19 +55,21 @@ struct io_impl<T, typename std::enable_if<is_opencv<T>::value>::type> {
     using value_type = typename T::value_type;
     DataSet dataset = initDataset<value_type>(file, path, shape(data), options);
     std::vector<value_type> v(data.begin(), data.end());
-    dataset.write_raw(v.data());
+    dataset.write_raw(v.data(), DataType(), options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
     return dataset;
   }
 
-  inline static T load(const File& file, const std::string& path) {
+  inline static T load(const File& file,
+                       const std::string& path,
+                       const DataTransferProps& xferProps) {
     using value_type = typename T::value_type;
     DataSet dataset = file.getDataSet(path);
     std::vector<int> dims = shape(file, path, dataset.getDimensions());
     T data(dims[0], dims[1]);
-    dataset.read(reinterpret_cast<value_type*>(data.data));
+    dataset.read(reinterpret_cast<value_type*>(data.data), DataType(), xferProps);
     return data;
   }
 
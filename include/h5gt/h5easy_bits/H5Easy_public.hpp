@@ -47,6 +47,11 @@ inline void DumpOptions::set(const Compression& level)
   m_compression_level = level.get();
 }
 
+inline void DumpOptions::set(const DataTransferProps& xferProps)
+{
+  m_xfer_props = xferProps;
+}
+
 template <class T, class... Args>
 inline void DumpOptions::set(T arg, Args... args)
 {
@@ -95,6 +100,11 @@ inline std::vector<hsize_t> DumpOptions::getChunkSize() const
   return m_chunk_size;
 }
 
+inline const DataTransferProps& DumpOptions::getTransferProps() const
+{
+  return m_xfer_props;
+}
+
 inline size_t getSize(const File& file, const std::string& path) {
   return file.getDataSet(path).getElementCount();
 }
@@ -155,12 +165,28 @@ inline DataSet dump(File& file,
 
 template <class T>
 inline T load(const File& file, const std::string& path, const std::vector<size_t>& idx) {
-  return detail::io_impl<T>::load_part(file, path, idx);
+  return detail::io_impl<T>::load_part(file, path, idx, DataTransferProps::Default());
 }
 
 template <class T>
 inline T load(const File& file, const std::string& path) {
-  return detail::io_impl<T>::load(file, path);
+  return detail::io_impl<T>::load(file, path, DataTransferProps::Default());
+}
+
+template <class T, class P,
+          typename std::enable_if<std::is_same<P, DataTransferProps>::value, int>::type>
+inline T load(const File& file,
+              const std::string& path,
+              const P& xferProps) {
+  return detail::io_impl<T>::load(file, path, xferProps);
+}
+
+template <class T>
+inline T load(const File& file,
+              const std::string& path,
+              const std::vector<size_t>& idx,
+              const DataTransferProps& xferProps) {
+  return detail::io_impl<T>::load_part(file, path, idx, xferProps);
 }
 
 template <class T>
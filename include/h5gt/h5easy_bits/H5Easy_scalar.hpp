@@ -28,17 +28,19 @@ struct io_impl {
                              const T& data,
                              const DumpOptions& options) {
     DataSet dataset = initScalarDataset(file, path, data, options);
-    dataset.write(data);
+    dataset.write(data, options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
     return dataset;
   }
 
-  inline static T load(const File& file, const std::string& path) {
+  inline static T load(const File& file,
+                       const std::string& path,
+                       const DataTransferProps& xferProps) {
     DataSet dataset = file.getDataSet(path);
     T data;
-    dataset.read(data);
+    dataset.read(data, xferProps);
     return data;
   }
 
@@ -86,7 +88,7 @@ struct io_impl {
       if (shape != dims) {
         dataset.resize(shape);
       }
-      dataset.select(idx, ones).write(data);
+      dataset.select(idx, ones).write(data, options.getTransferProps());
       if (options.flush()) {
         file.flush();
       }
@@ -111,8 +113,8 @@ struct io_impl {
     DataSetCreateProps props;
     props.setChunk(chunks);
     DataSet dataset = file.createDataSet(
-          path, dataspace, AtomicType<T>(), LinkCreateProps(), props);
-    dataset.select(idx, ones).write(data);
+          path, dataspace, AtomicType<T>(), LinkCreateProps::Default(), props);
+    dataset.select(idx, ones).write(data, options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
@@ -121,11 +123,12 @@ struct io_impl {
 
   inline static T load_part(const File& file,
                             const std::string& path,
-                            const std::vector<size_t>& idx) {
+                            const std::vector<size_t>& idx,
+                            const DataTransferProps& xferProps) {
     std::vector<size_t> ones(idx.size(), 1);
     DataSet dataset = file.getDataSet(path);
     T data;
-    dataset.select(idx, ones).read(data);
+    dataset.select(idx, ones).read(data, xferProps);
     return data;
   }
 };
@@ -34,17 +34,19 @@ struct io_impl<T, typename std::enable_if<is_vector<T>::value>::type> {
     using value_type = typename inspector<T>::base_type;
     auto dims = inspector<T>::getDimensions(data);
     DataSet dataset = initDataset<value_type>(file, path, std::vector<size_t>(dims.begin(), dims.end()), options);
-    dataset.write(data);
+    dataset.write(data, options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
     return dataset;
   }
 
-  inline static T load(const File& file, const std::string& path) {
+  inline static T load(const File& file,
+                       const std::string& path,
+                       const DataTransferProps& xferProps) {
     DataSet dataset = file.getDataSet(path);
     T data;
-    dataset.read(data);
+    dataset.read(data, xferProps);
     return data;
   }
 
@@ -39,18 +39,20 @@ struct io_impl<T, typename std::enable_if<is_xtensor<T>::value>::type> {
                              const DumpOptions& options) {
     using value_type = typename std::decay_t<T>::value_type;
     DataSet dataset = initDataset<value_type>(file, path, shape(data), options);
-    dataset.write_raw(data.data());
+    dataset.write_raw(data.data(), DataType(), options.getTransferProps());
     if (options.flush()) {
       file.flush();
     }
     return dataset;
   }
 
-  inline static T load(const File& file, const std::string& path) {
+  inline static T load(const File& file,
+                       const std::string& path,
+                       const DataTransferProps& xferProps) {
     DataSet dataset = file.getDataSet(path);
     std::vector<size_t> dims = dataset.getDimensions();
     T data = T::from_shape(dims);
-    dataset.read(data.data());
+    dataset.read(data.data(), DataType(), xferProps);
     return data;
   }
 
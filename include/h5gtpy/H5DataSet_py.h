@@ -2,6 +2,8 @@
 
 namespace h5gtpy {
 
+void ChunkInfo_py(py::class_<ChunkInfo> &py_obj);
+
 void DataSet_py(py::class_<DataSet, Object, SliceTraits<DataSet>, AnnotateTraits<DataSet> > &py_obj);
 
 
@@ -8,6 +8,11 @@ void PropertyType_py(py::enum_<PropertyType> &py_obj);
 void DataTypeClass_py(py::enum_<DataTypeClass> &py_obj);
 void OpenFlag_py(py::enum_<File::OpenFlag> &py_obj);
 void Endian_py(py::enum_<Endian> &py_obj);
+void FileSpaceStrategy_py(py::enum_<H5F_fspace_strategy_t> &py_obj);
+void LibVersion_py(py::enum_<H5F_libver_t> &py_obj);
+void ScaleOffsetType_py(py::enum_<H5Z_SO_scale_type_t> &py_obj);
+void AllocTime_py(py::enum_<H5D_alloc_time_t> &py_obj);
+void FillTime_py(py::enum_<H5D_fill_time_t> &py_obj);
 
 
 } // h5gtpy
@@ -0,0 +1,10 @@
+#include "h5gt_py.h"
+
+namespace h5gtpy {
+
+void FilterInfo_py(py::class_<FilterInfo> &py_obj);
+
+void Filter_py(py::module_ &m);
+
+
+} // h5gtpy
@@ -10,9 +10,9 @@ DataSet createDataSet_wrap1(
     const std::string& dset_name,
     const DataSpace& space,
     const DataType& type,
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps()){
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default()){
   return self.createDataSet(dset_name, space, type, linkCreateProps, dsetCreateProps, dsetAccessProps);
 }
 
@@ -22,9 +22,9 @@ DataSet createDataSet_wrap2(
     const std::string& dset_name,
     const std::vector<size_t>& dims,
     const DataType& type,
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps()){
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default()){
   return self.createDataSet(dset_name, DataSpace(dims), type, linkCreateProps, dsetCreateProps, dsetAccessProps);
 }
 
@@ -34,9 +34,9 @@ DataSet createDataSet_wrap3(
     const std::string& dset_name,
     const size_t& dim,
     const DataType& type,
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps(),
-    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps()){
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const DataSetCreateProps& dsetCreateProps = DataSetCreateProps::Default(),
+    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default()){
   return self.createDataSet(dset_name, DataSpace(dim), type, linkCreateProps, dsetCreateProps, dsetAccessProps);
 }
 
@@ -44,9 +44,9 @@ template <typename Derivate>
 Group copy_wrap1(
     NodeTraits<Derivate>& self,
     const Group& obj, const std::string& objNewName,
-    const ObjectCopyProps& copyProps = ObjectCopyProps(),
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const GroupAccessProps& groupAccessProps = GroupAccessProps()){
+    const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const GroupAccessProps& groupAccessProps = GroupAccessProps::Default()){
   return self.copy(obj, objNewName, copyProps, linkCreateProps, groupAccessProps);
 }
 
@@ -54,9 +54,9 @@ template <typename Derivate>
 DataSet copy_wrap2(
     NodeTraits<Derivate>& self,
     const DataSet& obj, const std::string& objNewName,
-    const ObjectCopyProps& copyProps = ObjectCopyProps(),
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps()){
+    const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default()){
   return self.copy(obj, objNewName, copyProps, linkCreateProps, dsetAccessProps);
 }
 
@@ -64,9 +64,9 @@ template <typename Derivate>
 DataType copy_wrap3(
     NodeTraits<Derivate>& self,
     const DataType& obj, const std::string& objNewName,
-    const ObjectCopyProps& copyProps = ObjectCopyProps(),
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps()){
+    const ObjectCopyProps& copyProps = ObjectCopyProps::Default(),
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps::Default()){
   return self.copy(obj, objNewName, copyProps, linkCreateProps, dtypeAccessProps);
 }
 
@@ -77,9 +77,9 @@ DataSet createLink_wrap1(
     const std::string& linkName,
     const LinkType& linkType,
     const std::string& targetPath = "",
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const LinkAccessProps& linkAccessProps = LinkAccessProps(),
-    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps()){
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
+    const DataSetAccessProps& dsetAccessProps = DataSetAccessProps::Default()){
   return self.createLink(target, linkName, linkType, targetPath, linkCreateProps, linkAccessProps, dsetAccessProps);
 }
 
@@ -90,9 +90,9 @@ DataType createLink_wrap2(
     const std::string& linkName,
     const LinkType& linkType,
     const std::string& targetPath = "",
-    const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-    const LinkAccessProps& linkAccessProps = LinkAccessProps(),
-    const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps()){
+    const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+    const LinkAccessProps& linkAccessProps = LinkAccessProps::Default(),
+    const DataTypeAccessProps& dtypeAccessProps = DataTypeAccessProps::Default()){
   return self.createLink(target, linkName, linkType, targetPath, linkCreateProps, linkAccessProps, dtypeAccessProps);
 }
 
@@ -116,45 +116,45 @@ void NodeTraits_py(py::class_<NodeTraits<Derivate> >& py_obj) {
            py::arg("dset_name"),
            py::arg("space"),
            py::arg("type"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("dsetCreateProps", DataSetCreateProps(), "DataSetCreateProps()"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"))
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("dsetCreateProps", DataSetCreateProps::Default(), "DataSetCreateProps.Default()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"))
       .def("createDataSet", &ext::createDataSet_wrap2<Derivate>,
            py::arg("dset_name"),
            py::arg("dims"),
            py::arg("type"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("dsetCreateProps", DataSetCreateProps(), "DataSetCreateProps()"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"))
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("dsetCreateProps", DataSetCreateProps::Default(), "DataSetCreateProps.Default()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"))
       .def("createDataSet", &ext::createDataSet_wrap3<Derivate>,
            py::arg("dset_name"),
            py::arg("dim"),
            py::arg("type"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("dsetCreateProps", DataSetCreateProps(), "DataSetCreateProps()"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"))
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("dsetCreateProps", DataSetCreateProps::Default(), "DataSetCreateProps.Default()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"))
       .def("getDataType", &NodeTraits<Derivate>::getDataType,
            py::arg("dtype_name"),
-           py::arg_v("dtypeAccessProps", DataTypeAccessProps(), "DataTypeAccessProps()"))
+           py::arg_v("dtypeAccessProps", DataTypeAccessProps::Default(), "DataTypeAccessProps.Default()"))
       .def("getDataSet", &NodeTraits<Derivate>::getDataSet,
            py::arg("dset_name"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"),
            "Get an existing dataset in the current file")
       .def("createGroup", &NodeTraits<Derivate>::createGroup,
            py::arg("group_name"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("groupCreateProps", GroupCreateProps(), "GroupCreateProps()"),
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("groupCreateProps", GroupCreateProps::Default(), "GroupCreateProps.Default()"),
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"),
            "Create a new group, and eventually intermediate groups")
       .def("getGroup", &NodeTraits<Derivate>::getGroup,
            py::arg("group_name"),
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"),
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"),
            "return the number of leaf objects of the node / group")
       .def("getFile", &NodeTraits<Derivate>::getFile)
       .def("getNumberObjects", &NodeTraits<Derivate>::getNumberObjects)
       .def("getObjectName", &NodeTraits<Derivate>::getObjectName,
            py::arg("index"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"))
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"))
       .def("getLinkInfo", &NodeTraits<Derivate>::getLinkInfo,
            py::arg("objName"))
       .def("unpackSoftLink", &NodeTraits<Derivate>::unpackSoftLink,
@@ -166,60 +166,63 @@ void NodeTraits_py(py::class_<NodeTraits<Derivate> >& py_obj) {
       .def("rename", &NodeTraits<Derivate>::rename,
            py::arg("src_path"),
            py::arg("dest_path"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            "Moves an object and its content within an HDF5 file.")
       .def("listObjectNames", &NodeTraits<Derivate>::listObjectNames)
       .def("exist", &NodeTraits<Derivate>::exist,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            py::arg_v("raise_errors", false, "False"),
            "Check a dataset or group exists in the current node / group")
       .def("resolved", &NodeTraits<Derivate>::resolved,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            py::arg_v("raise_errors", false, "False"),
            "Check a dataset or group in the current node / group may be resolved or not")
       .def("existAndResolved", &NodeTraits<Derivate>::existAndResolved,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            py::arg_v("raise_errors", false, "False"),
            "Call 'exist()' with subsequent call to 'resolved()' if successful")
       .def("hasObject", &NodeTraits<Derivate>::hasObject,
            py::arg("objName"),
            py::arg("objectType"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            py::arg_v("raise_errors", false, "False"),
            "Advanced version of `exist` that also checks the type of object")
       .def("unlink", &NodeTraits<Derivate>::unlink,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"))
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"))
       .def("getLinkType", &NodeTraits<Derivate>::getLinkType,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            "Unlink the given dataset or group. NOTE: unlink doesn't frees memory. Use `h5repack` to free unused space")
       .def("getObjectType", &NodeTraits<Derivate>::getObjectType,
            py::arg("obj_name"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
            "A shorthand to get the kind of object pointed to (group, dataset, type...)")
       .def("copy", &ext::copy_wrap1<Derivate>,
            py::arg("group"),
            py::arg("objNewName"),
-           py::arg_v("copyProps", ObjectCopyProps(), "ObjectCopyProps()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("groupAccessProps", LinkAccessProps(), "LinkAccessProps()"))
+           py::arg_v("copyProps", ObjectCopyProps::Default(), "ObjectCopyProps.Default()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("groupAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
+           py::call_guard<IOGuard>())
       .def("copy", &ext::copy_wrap2<Derivate>,
            py::arg("dset"),
            py::arg("objNewName"),
-           py::arg_v("copyProps", ObjectCopyProps(), "ObjectCopyProps()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"))
+           py::arg_v("copyProps", ObjectCopyProps::Default(), "ObjectCopyProps.Default()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"),
+           py::call_guard<IOGuard>())
       .def("copy", &ext::copy_wrap3<Derivate>,
            py::arg("dtype"),
            py::arg("objNewName"),
-           py::arg_v("copyProps", ObjectCopyProps(), "ObjectCopyProps()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("dtypeAccessProps", DataTypeAccessProps(), "DataTypeAccessProps()"))
+           py::arg_v("copyProps", ObjectCopyProps::Default(), "ObjectCopyProps.Default()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("dtypeAccessProps", DataTypeAccessProps::Default(), "DataTypeAccessProps.Default()"),
+           py::call_guard<IOGuard>())
       .def("createLink", py::overload_cast<
            const File&,
            const std::string&,
@@ -232,9 +235,9 @@ void NodeTraits_py(py::class_<NodeTraits<Derivate> >& py_obj) {
            py::arg("linkName"),// "name for a new link",
            py::arg("linkType"),
            py::arg_v("targetPath", std::string(), "str()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccesProps", LinkAccessProps(), "LinkAccessProps()"),
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccesProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"),
            "Creates link to a `File`")
       .def("createLink", py::overload_cast<
            const Group&,
@@ -248,27 +251,27 @@ void NodeTraits_py(py::class_<NodeTraits<Derivate> >& py_obj) {
            py::arg("linkName"),// "name for a new link",
            py::arg("linkType"),
            py::arg_v("targetPath", std::string(), "str()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccesProps", LinkAccessProps(), "LinkAccessProps()"),
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccesProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"),
            "Creates link to a `Group`")
       .def("createLink", &ext::createLink_wrap1<Derivate>,
            py::arg("dset"),// "target object",
            py::arg("linkName"),// "name for a new link",
            py::arg("linkType"),
            py::arg_v("targetPath", std::string(), "str()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccesProps", LinkAccessProps(), "LinkAccessProps()"),
-           py::arg_v("dsetAccessProps", DataSetAccessProps(), "DataSetAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccesProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
+           py::arg_v("dsetAccessProps", DataSetAccessProps::Default(), "DataSetAccessProps.Default()"),
            "Creates link to a `DataSet`")
       .def("createLink", &ext::createLink_wrap2<Derivate>,
            py::arg("dtype"),// "target object",
            py::arg("linkName"),// "name for a new link",
            py::arg("linkType"),
            py::arg_v("targetPath", std::string(), "str()"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccesProps", LinkAccessProps(), "LinkAccessProps()"),
-           py::arg_v("dtypeAccessProps", DataTypeAccessProps(), "DataTypeAccessProps()"),
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccesProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"),
+           py::arg_v("dtypeAccessProps", DataTypeAccessProps::Default(), "DataTypeAccessProps.Default()"),
            "Creates link to a `DataType`");
 }
 
@@ -7,7 +7,9 @@ void PropertyList_py(py::class_<PropertyList<T> >& py_obj) {
   py_obj
       .def("getObjectType", &PropertyList<T>::getObjectType)
       .def("getId", &PropertyList<T>::getId,
-           py::arg_v("increaseRefCount", false, "false"));
+           py::arg_v("increaseRefCount", false, "false"))
+      .def("isDefault", &PropertyList<T>::isDefault,
+           "Whether the object is backed by `H5P_DEFAULT` (can't be modified)");
 }
 
 void LinkCreateProps_py(py::class_<LinkCreateProps, PropertyList<PropertyType::LINK_CREATE> > &py_obj);
@@ -20,6 +22,7 @@ void DataSetCreateProps_py(py::class_<DataSetCreateProps, PropertyList<PropertyT
 void DataSetAccessProps_py(py::class_<DataSetAccessProps, PropertyList<PropertyType::DATASET_ACCESS> > &py_obj);
 void DataTypeCreateProps_py(py::class_<DataTypeCreateProps, PropertyList<PropertyType::DATATYPE_CREATE> > &py_obj);
 void DataTypeAccessProps_py(py::class_<DataTypeAccessProps, PropertyList<PropertyType::DATATYPE_ACCESS> > &py_obj);
+void DataTransferProps_py(py::class_<DataTransferProps, PropertyList<PropertyType::DATASET_XFER> > &py_obj);
 void ObjectCopyProps_py(py::class_<ObjectCopyProps, PropertyList<PropertyType::OBJECT_COPY> > &py_obj);
 
 
@@ -4,31 +4,25 @@ namespace h5gtpy {
 
 namespace ext {
 
-template <typename Derivate, typename T>
-void write_vector_raw(SliceTraits<Derivate>& self, std::vector<T>& v){
-  self.write_raw(v.data(), AtomicType<T>());
-};
-
-template <typename Derivate, typename T>
-void write_eigen_raw(SliceTraits<Derivate>& self, py::EigenDRef<Eigen::MatrixX<T>> M){
-  self.write_raw(M.data(), AtomicType<T>());
-};
-
-template <typename Derivate, typename T>
-std::vector<T> read_vector_raw(SliceTraits<Derivate>& self){
-  static_assert(!std::is_const<T>::value,
-      "read() requires a non-const structure to read data into");
-  const auto& slice = static_cast<const Derivate&>(self);
-
-  std::vector<T> v;
-  v.resize(slice.getSpace().getElementCount());
-
-  slice.read(v.data(), slice.getDataType());
-  return v;
+/// \brief Read strings to StringTable (HDF5 allocates them in its arena)
+/// and convert them to Python list
+template <typename Derivate>
+py::list read_str_table(SliceTraits<Derivate>& self,
+                        const DataTransferProps& xferProps){
+  StringTable table;
+  {
+    IOGuard guard;
+    self.read(table, xferProps);
+  }
+  py::list list(table.size());
+  for (size_t i = 0; i < table.size(); i++)
+    list[i] = py::str(table[i].data(), table[i].size());
+  return list;
 }
 
 template <typename Derivate, typename T>
-Eigen::MatrixX<T> read_eigen_raw(SliceTraits<Derivate>& self){
+Eigen::MatrixX<T> read_eigen_raw(SliceTraits<Derivate>& self,
+                                 const DataTransferProps& xferProps){
   static_assert(!std::is_const<T>::value,
       "read() requires a non-const structure to read data into");
   const auto& slice = static_cast<const Derivate&>(self);
@@ -44,10 +38,349 @@ Eigen::MatrixX<T> read_eigen_raw(SliceTraits<Derivate>& self){
     M.resize(slice.getSpace().getElementCount(), 1);
   }
 
-  slice.read(M.data(), slice.getDataType());
+  slice.read(M.data(), slice.getDataType(), xferProps);
   return M;
 }
 
+template <typename T>
+DataType make_atomic_type(Endian endian){
+  return AtomicType<T>(endian);
+}
+
+/// \brief Element type of NumPy array: numbers, fixed length strings,
+/// subarrays and structs (compound) of them with the same offsets and padding.
+/// It is taken from dtype while holding the GIL or from HDF5 type under
+/// IOGuard and converted to the other side later, so that the GIL and
+/// HDF5 are never needed at the same time. Numbers are found in a table
+/// by dtype kind and item size so that read/write dispatch is a single
+/// lookup instead of pybind11 overloads
+struct ArrayElement {
+  using Factory = DataType (*)(Endian);
+
+  enum class Kind { Atomic, String, Array, Compound };
+
+  Kind kind = Kind::Atomic;
+  char code = 0;                    // dtype kind of Atomic
+  size_t size = 0;                  // item size
+  Factory factory = nullptr;        // Atomic
+  Endian endian = Endian::Native;   // Atomic
+  std::vector<hsize_t> dims;        // Array
+  std::vector<std::string> names;   // Compound
+  std::vector<size_t> offsets;      // Compound
+  std::vector<ArrayElement> members;  // Compound members or Array base
+
+  explicit ArrayElement(const py::dtype& dt){
+    size = static_cast<size_t>(dt.itemsize());
+    py::object fields = dt.attr("fields");
+    py::object subdtype = dt.attr("subdtype");
+    if (!fields.is_none()){
+      kind = Kind::Compound;
+      for (auto name : dt.attr("names")){
+        py::tuple field = fields[name].cast<py::tuple>();
+        names.push_back(name.cast<std::string>());
+        members.emplace_back(field[0].cast<py::dtype>());
+        offsets.push_back(field[1].cast<size_t>());
+      }
+    } else if (!subdtype.is_none()){
+      kind = Kind::Array;
+      members.emplace_back(subdtype[py::int_(0)].cast<py::dtype>());
+      for (auto d : subdtype[py::int_(1)])
+        dims.push_back(d.cast<hsize_t>());
+    } else if (dt.kind() == 'S'){
+      kind = Kind::String;
+    } else {
+      code = dt.kind();
+      factory = findFactory(code, size);
+      if (!factory)
+        throw py::type_error("Unsupported numpy dtype: " + std::string(py::str(dt)));
+      const char order = dt.attr("byteorder").cast<std::string>()[0];
+      endian = order == '<' ? Endian::Little :
+               order == '>' ? Endian::Big : Endian::Native;
+    }
+  }
+
+  /// \brief Element of native memory layout corresponding
+  /// to HDF5 type (needs IOGuard)
+  explicit ArrayElement(const DataType& dtype){
+    hid_t hid = H5Tget_native_type(dtype.getId(false), H5T_DIR_ASCEND);
+    if (hid < 0)
+      HDF5ErrMapper::ToException<DataTypeException>(
+            "Unable to get native type of " + dtype.string());
+    const DataType native = DataType::FromId(hid);
+    describe(native.getId(false));
+  }
+
+  /// \brief HDF5 memory type (needs IOGuard)
+  DataType getDataType() const {
+    switch (kind) {
+    case Kind::Atomic:
+      return factory(endian);
+    case Kind::String: {
+      hid_t hid = H5Tcopy(H5T_C_S1);
+      H5Tset_size(hid, size);
+      H5Tset_strpad(hid, H5T_STR_NULLPAD);
+      return DataType::FromId(hid);
+    }
+    case Kind::Array: {
+      const DataType base = members[0].getDataType();
+      hid_t hid = H5Tarray_create2(base.getId(false),
+                                   static_cast<unsigned>(dims.size()), dims.data());
+      if (hid < 0)
+        HDF5ErrMapper::ToException<DataTypeException>("Unable to create array datatype");
+      return DataType::FromId(hid);
+    }
+    default: {
+      std::vector<CompoundType::member_def> defs;
+      for (size_t i = 0; i < members.size(); i++)
+        defs.emplace_back(names[i], members[i].getDataType(), offsets[i]);
+      return CompoundType(std::move(defs), size);
+    }
+    }
+  }
+
+  /// \brief NumPy dtype (needs the GIL)
+  py::dtype getDtype() const {
+    switch (kind) {
+    case Kind::Atomic:
+      return py::dtype::from_args(py::str(std::string(1, code) + std::to_string(size)));
+    case Kind::String:
+      return py::dtype::from_args(py::str("S" + std::to_string(size)));
+    case Kind::Array: {
+      py::tuple shape(dims.size());
+      for (size_t i = 0; i < dims.size(); i++)
+        shape[i] = py::int_(dims[i]);
+      return py::dtype::from_args(py::make_tuple(members[0].getDtype(), shape));
+    }
+    default: {
+      py::list formats, fieldNames, fieldOffsets;
+      for (size_t i = 0; i < members.size(); i++){
+        fieldNames.append(py::str(names[i]));
+        formats.append(members[i].getDtype());
+        fieldOffsets.append(py::int_(offsets[i]));
+      }
+      py::dict d;
+      d["names"] = fieldNames;
+      d["formats"] = formats;
+      d["offsets"] = fieldOffsets;
+      d["itemsize"] = py::int_(size);
+      return py::dtype::from_args(d);
+    }
+    }
+  }
+
+private:
+  static Factory findFactory(char code, size_t itemsize){
+    struct Entry {
+      char kind;
+      size_t itemsize;
+      Factory factory;
+    };
+    static const Entry table[] = {
+      {'b', 1, &make_atomic_type<bool>},
+      {'i', 1, &make_atomic_type<signed char>},
+      {'i', 2, &make_atomic_type<short>},
+      {'i', 4, &make_atomic_type<int>},
+      {'i', 8, &make_atomic_type<long long>},
+      {'u', 1, &make_atomic_type<unsigned char>},
+      {'u', 2, &make_atomic_type<unsigned short>},
+      {'u', 4, &make_atomic_type<unsigned>},
+      {'u', 8, &make_atomic_type<unsigned long long>},
+      {'f', 4, &make_atomic_type<float>},
+      {'f', 8, &make_atomic_type<double>},
+      {'c', 8, &make_atomic_type<std::complex<float>>},
+      {'c', 16, &make_atomic_type<std::complex<double>>}
+    };
+
+    for (const auto& entry : table){
+      if (entry.kind == code && entry.itemsize == itemsize)
+        return entry.factory;
+    }
+    return nullptr;
+  }
+
+  void setAtomic(char c){
+    code = c;
+    factory = findFactory(code, size);
+  }
+
+  /// \brief complex numbers are stored as h5py compatible
+  /// compound of two floats named "r" and "i"
+  static bool isComplex(hid_t hid){
+    if (H5Tget_nmembers(hid) != 2 ||
+        H5Tget_member_class(hid, 0) != H5T_FLOAT ||
+        H5Tget_member_class(hid, 1) != H5T_FLOAT)
+      return false;
+    char* r = H5Tget_member_name(hid, 0);
+    char* i = H5Tget_member_name(hid, 1);
+    const bool ok = std::string(r) == "r" && std::string(i) == "i";
+    H5free_memory(r);
+    H5free_memory(i);
+    return ok;
+  }
+
+  void describe(hid_t hid){
+    size = H5Tget_size(hid);
+    switch (H5Tget_class(hid)) {
+    case H5T_INTEGER:
+      setAtomic(H5Tget_sign(hid) == H5T_SGN_NONE ? 'u' : 'i');
+      break;
+    case H5T_FLOAT:
+      setAtomic('f');
+      break;
+    case H5T_ENUM: {
+      const DataType base = DataType::FromId(H5Tget_super(hid));
+      describe(base.getId(false));
+      break;
+    }
+    case H5T_STRING:
+      if (H5Tis_variable_str(hid) <= 0)
+        kind = Kind::String;
+      break;
+    case H5T_ARRAY: {
+      kind = Kind::Array;
+      dims.resize(static_cast<size_t>(H5Tget_array_ndims(hid)));
+      H5Tget_array_dims2(hid, dims.data());
+      const DataType base = DataType::FromId(H5Tget_super(hid));
+      members.emplace_back(base);
+      return;
+    }
+    case H5T_COMPOUND:
+      if (isComplex(hid)){
+        setAtomic('c');
+        break;
+      }
+      kind = Kind::Compound;
+      for (int i = 0; i < H5Tget_nmembers(hid); i++){
+        char* name = H5Tget_member_name(hid, static_cast<unsigned>(i));
+        names.emplace_back(name);
+        H5free_memory(name);
+        offsets.push_back(H5Tget_member_offset(hid, static_cast<unsigned>(i)));
+        const DataType member = DataType::FromId(
+              H5Tget_member_type(hid, static_cast<unsigned>(i)));
+        members.emplace_back(member);
+      }
+      return;
+    default:
+      break;
+    }
+    if (kind == Kind::Atomic && !factory){
+      const DataType dtype = DataType::FromId(H5Tcopy(hid));
+      throw DataTypeException(
+            "Unable to map datatype " + dtype.string() + " to numpy dtype");
+    }
+  }
+};
+
+/// \brief Read selection directly to C-ordered NumPy array.
+/// If `out` is None the array is allocated with selection shape and
+/// `dtype` (native dtype of the dataset if None: structured dtype
+/// for compound types), otherwise `out`
+/// must be C-contiguous writeable array with the same number of elements
+template <typename Derivate>
+py::array read_array(SliceTraits<Derivate>& self, py::object out,
+                     py::object dtype, const DataTransferProps& xferProps){
+  const auto& slice = static_cast<const Derivate&>(self);
+
+  std::vector<size_t> dims;
+  size_t nElements;
+  std::unique_ptr<ArrayElement> native;
+  {
+    IOGuard guard;
+    const DataSpace memSpace = slice.getMemSpace();
+    dims = memSpace.getDimensions();
+    nElements = memSpace.getElementCount();
+    if (out.is_none() && dtype.is_none())
+      native.reset(new ArrayElement(slice.getDataType()));
+  }
+
+  py::array arr;
+  if (out.is_none()){
+    arr = py::array(native ?
+                      native->getDtype() :
+                      py::dtype::from_args(dtype),
+                    std::vector<py::ssize_t>(dims.begin(), dims.end()));
+  } else {
+    if (!py::isinstance<py::array>(out))
+      throw py::type_error("`out` must be numpy array");
+    arr = py::reinterpret_borrow<py::array>(out);
+    if (!(arr.flags() & py::array::c_style) || !arr.writeable())
+      throw py::value_error("`out` must be C-contiguous and writeable");
+    if (static_cast<size_t>(arr.size()) != nElements)
+      throw py::value_error(
+            "`out` has " + std::to_string(arr.size()) +
+            " elements while selection has " + std::to_string(nElements));
+  }
+
+  const ArrayElement element(arr.dtype());
+  char* buffer = static_cast<char*>(arr.mutable_data());
+  {
+    IOGuard guard;
+    slice.read(buffer, element.getDataType(), xferProps);
+  }
+  return arr;
+}
+
+/// \brief Write NumPy array buffer as is (no dimensionality checks).
+/// C or F contiguous arrays are written without copying,
+/// other arrays are copied to C order first
+template <typename Derivate>
+void write_array_raw(SliceTraits<Derivate>& self, py::array data,
+                     const DataTransferProps& xferProps){
+  if (!(data.flags() & (py::array::c_style | py::array::f_style)))
+    data = py::array::ensure(data, py::array::c_style);
+  const ArrayElement element(data.dtype());
+  const char* buffer = static_cast<const char*>(data.data());
+  IOGuard guard;
+  self.write_raw(buffer, element.getDataType(), xferProps);
+}
+
+/// \brief Write string, sequence of strings, number, sequence of numbers
+/// or NumPy array. Numbers are converted to C-ordered NumPy array (without
+/// copying if it is already) and the memory type is chosen by its dtype
+template <typename Derivate>
+void write_any(SliceTraits<Derivate>& self, py::object data,
+               const DataTransferProps& xferProps){
+  if (py::isinstance<py::str>(data)){
+    std::string str = data.cast<std::string>();
+    IOGuard guard;
+    self.write(str, xferProps);
+    return;
+  }
+
+  py::array arr = py::array::ensure(data);
+  if (!arr)
+    throw py::type_error("Unable to convert data to numpy array");
+
+  const char kind = arr.dtype().kind();
+  if (kind == 'U' || kind == 'S'){
+    std::vector<std::string> strs =
+        arr.attr("ravel")().attr("tolist")().cast<std::vector<std::string>>();
+    IOGuard guard;
+    self.write(strs, xferProps);
+    return;
+  }
+
+  const size_t nDims = static_cast<size_t>(arr.ndim());
+  arr = py::array::ensure(arr, py::array::c_style);
+  const ArrayElement element(arr.dtype());
+  const char* buffer = static_cast<const char*>(arr.data());
+
+  IOGuard guard;
+  const auto& slice = static_cast<const Derivate&>(self);
+  const DataSpace memSpace = slice.getMemSpace();
+  if (!details::checkDimensions(memSpace, nDims)) {
+    std::ostringstream ss;
+    ss << "Impossible to write buffer of dimensions " << nDims
+       << " into dataset of dimensions " << memSpace.getNumberDimensions();
+    throw DataSpaceException(ss.str());
+  }
+  if (memSpace.getElementCount() != static_cast<size_t>(arr.size()))
+    throw DataSpaceException(
+          "Impossible to write buffer of " + std::to_string(arr.size()) +
+          " elements into selection of " +
+          std::to_string(memSpace.getElementCount()) + " elements");
+  self.write_raw(buffer, element.getDataType(), xferProps);
+}
 
 } // ext
 
@@ -83,101 +416,95 @@ void SliceTraits_py(py::class_<SliceTraits<Derivate> >& py_obj) {
            py::arg("ind"),
            py::arg_v("offset", 0, "0"),
            py::arg_v("count", 0, "0"))
+      .def("select_along", &SliceTraits<Derivate>::select_along,
+           py::arg("axis"),
+           py::arg("ind"),
+           py::arg("offset"),
+           py::arg("count"),
+           py::arg_v("stride", std::vector<size_t>(), "list()"),
+           "Select indices `ind` along `axis` (unordered and duplicated allowed) "
+           "and `count` elements separated by `stride` starting from `offset` "
+           "along other dimensions")
+
+
+      // WRITE
+      .def("write", &ext::write_any<Derivate>,
+           py::arg("data"),
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           "Write str, list of str, number, list of numbers or numpy array. "
+           "The memory type is chosen by numpy dtype "
+           "(structured arrays are written as compound type matched by field names). "
+           "An exception is raised if the numbers of dimension of the buffer and of the dataset are different. "
+           "Arrays are written in C order (`readX` return them transposed, use `read`)")
 
 
-      // WRITE PY_TYPES
-      .def("write", &SliceTraits<Derivate>::template write<bool>,
-           py::arg("data"), "An exception is raised if the numbers of dimension of the buffer and of the dataset are different")
-      .def("write", &SliceTraits<Derivate>::template write<long long>)
-      .def("write", &SliceTraits<Derivate>::template write<double>)
-      .def("write", &SliceTraits<Derivate>::template write<std::complex<double>>)
-      .def("write", &SliceTraits<Derivate>::template write<std::string>)
-
-      // WRITE VECTOR_TYPES
-      .def("write", &SliceTraits<Derivate>::template write<std::vector<long long>>)
-      .def("write", &SliceTraits<Derivate>::template write<std::vector<double>>)
-      .def("write", &SliceTraits<Derivate>::template write<std::vector<std::complex<double>>>)
-      .def("write", &SliceTraits<Derivate>::template write<std::vector<std::string>>)
-
-      // WRITE EIGEN_TYPES
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<bool>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<char>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<signed char>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<unsigned char>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<short>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<unsigned short>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<int>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<unsigned>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<long>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<unsigned long>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<long long>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<unsigned long long>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<float>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<double>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<std::complex<float>>>)
-      .def("write", &SliceTraits<Derivate>::template write<Eigen::MatrixX<std::complex<double>>>)
-
-
-      // WRITE_VECTOR_RAW
-      .def("write_raw", &ext::write_vector_raw<Derivate, long long>,
+      // WRITE_RAW
+      .def("write_raw", &ext::write_array_raw<Derivate>,
            py::arg("data"),
-           "No dimensionality checks will be performed")
-      .def("write_raw", &ext::write_vector_raw<Derivate, double>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_vector_raw<Derivate, std::complex<double>>,
-           py::arg("data"))
-//      .def("write_raw", &ext::write_vector_raw<Derivate, const char*>,  // without any error it doesn't write anything. Doesn't work
-//           py::arg("data"))
-
-      // WRITE_EIGEN_RAW
-      .def("write_raw", &ext::write_eigen_raw<Derivate, bool>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, char>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, signed char>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, unsigned char>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, short>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, unsigned short>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, int>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, unsigned>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, long long>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, unsigned long long>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, float>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, double>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, std::complex<float>>,
-           py::arg("data"))
-      .def("write_raw", &ext::write_eigen_raw<Derivate, std::complex<double>>,
-           py::arg("data"))
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           "No dimensionality checks will be performed. "
+           "C or F contiguous array is written without copying")
 
 
       // READ
-      .def("readBool", &ext::read_eigen_raw<Derivate, bool>)
-      .def("readChar", &ext::read_eigen_raw<Derivate, char>)
-      .def("readSChar", &ext::read_eigen_raw<Derivate, signed char>)
-      .def("readUChar", &ext::read_eigen_raw<Derivate, unsigned char>)
-      .def("readShort", &ext::read_eigen_raw<Derivate, short>)
-      .def("readUShort", &ext::read_eigen_raw<Derivate, unsigned short>)
-      .def("readInt", &ext::read_eigen_raw<Derivate, int>)
-      .def("readUInt", &ext::read_eigen_raw<Derivate, unsigned>)
-      .def("readLong", &ext::read_eigen_raw<Derivate, long>)
-      .def("readULong", &ext::read_eigen_raw<Derivate, unsigned long>)
-      .def("readLLong", &ext::read_eigen_raw<Derivate, long long>)
-      .def("readULLong", &ext::read_eigen_raw<Derivate, unsigned long long>)
-      .def("readFloat", &ext::read_eigen_raw<Derivate, float>)
-      .def("readDouble", &ext::read_eigen_raw<Derivate, double>)
-      .def("readCFloat", &ext::read_eigen_raw<Derivate, std::complex<float>>)
-      .def("readCDouble", &ext::read_eigen_raw<Derivate, std::complex<double>>)
-      .def("readStr", &ext::read_vector_raw<Derivate, const char*>);
+      .def("read", &ext::read_array<Derivate>,
+           py::arg_v("out", py::none(), "None"),
+           py::arg_v("dtype", py::none(), "None"),
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           "Read to C-ordered numpy array of selection shape and `dtype` "
+           "(native dtype of the dataset if None, structured dtype for compound type). "
+           "If `out` is given it must be C-contiguous writeable array "
+           "with the same number of elements and it is returned")
+      .def("readBool", &ext::read_eigen_raw<Derivate, bool>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readChar", &ext::read_eigen_raw<Derivate, char>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readSChar", &ext::read_eigen_raw<Derivate, signed char>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readUChar", &ext::read_eigen_raw<Derivate, unsigned char>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readShort", &ext::read_eigen_raw<Derivate, short>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readUShort", &ext::read_eigen_raw<Derivate, unsigned short>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readInt", &ext::read_eigen_raw<Derivate, int>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readUInt", &ext::read_eigen_raw<Derivate, unsigned>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readLong", &ext::read_eigen_raw<Derivate, long>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readULong", &ext::read_eigen_raw<Derivate, unsigned long>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readLLong", &ext::read_eigen_raw<Derivate, long long>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readULLong", &ext::read_eigen_raw<Derivate, unsigned long long>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readFloat", &ext::read_eigen_raw<Derivate, float>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readDouble", &ext::read_eigen_raw<Derivate, double>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readCFloat", &ext::read_eigen_raw<Derivate, std::complex<float>>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readCDouble", &ext::read_eigen_raw<Derivate, std::complex<double>>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"),
+           py::call_guard<IOGuard>())
+      .def("readStr", &ext::read_str_table<Derivate>,
+           py::arg_v("xferProps", DataTransferProps::Default(), "DataTransferProps.Default()"));
 }
 
 } // h5gtpy
@@ -10,19 +10,40 @@
 #include <h5gt/H5DataSet.hpp>
 #include <h5gt/H5DataSpace.hpp>
 
+#include <memory>
+
 #include <Eigen/Dense>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 #include <pybind11/complex.h>
+#include <pybind11/functional.h>
 #include <pybind11/operators.h>
 
 using namespace h5gt;
 
 namespace py = pybind11;
 
+namespace h5gtpy {
+
+/// \brief Releases the GIL for the duration of long running I/O
+/// (read/write, flush, copy, file open) so that other Python threads
+/// keep running. Use as `py::call_guard<IOGuard>()` for functions that
+/// don't touch Python objects or as a scoped variable otherwise.
+/// Every other binding (and `Object` destruction) calls HDF5 with the
+/// GIL held, so unless HDF5 is thread-safe the GIL is kept: it is the
+/// only lock that serializes all HDF5 calls made from Python
+struct IOGuard {
+#ifdef H5_HAVE_THREADSAFE
+  py::gil_scoped_release release;
+#endif
+};
+
+} // h5gtpy
+
 // opaque types must be included to every translation unit or ODR falls (warnings is given)
 PYBIND11_MAKE_OPAQUE(std::vector<CompoundType::member_def>);
 PYBIND11_MAKE_OPAQUE(std::vector<EnumType<int>::member_def>);
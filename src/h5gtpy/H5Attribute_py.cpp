@@ -66,97 +66,156 @@ void Attribute_py(py::class_<Attribute, Object> &py_obj){
 
       // WRITE PY_TYPES
       .def("write", &Attribute::write<bool>,
-           py::arg("data"), "An exception is raised if the numbers of dimension of the buffer and of the dataset are different")
-      .def("write", &Attribute::write<long long>)
-      .def("write", &Attribute::write<double>)
-      .def("write", &Attribute::write<std::complex<double>>)
-      .def("write", &Attribute::write<std::string>)
+           py::arg("data"), "An exception is raised if the numbers of dimension of the buffer and of the dataset are different",
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<long long>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<double>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<std::complex<double>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<std::string>,
+           py::call_guard<IOGuard>())
 
       // WRITE VECTOR_TYPES
-      .def("write", &Attribute::write<std::vector<long long>>)
-      .def("write", &Attribute::write<std::vector<double>>)
-      .def("write", &Attribute::write<std::vector<std::complex<double>>>)
-      .def("write", &Attribute::write<std::vector<std::string>>)
+      .def("write", &Attribute::write<std::vector<long long>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<std::vector<double>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<std::vector<std::complex<double>>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<std::vector<std::string>>,
+           py::call_guard<IOGuard>())
 
       // WRITE EIGEN_TYPES
-      .def("write", &Attribute::write<Eigen::MatrixX<bool>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<char>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<signed char>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<unsigned char>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<short>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<unsigned short>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<int>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<unsigned>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<long>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<unsigned long>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<long long>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<unsigned long long>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<float>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<double>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<std::complex<float>>>)
-      .def("write", &Attribute::write<Eigen::MatrixX<std::complex<double>>>)
+      .def("write", &Attribute::write<Eigen::MatrixX<bool>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<char>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<signed char>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<unsigned char>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<short>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<unsigned short>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<int>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<unsigned>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<long>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<unsigned long>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<long long>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<unsigned long long>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<float>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<double>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<std::complex<float>>>,
+           py::call_guard<IOGuard>())
+      .def("write", &Attribute::write<Eigen::MatrixX<std::complex<double>>>,
+           py::call_guard<IOGuard>())
 
 
       // write_vector_raw_attr
       .def("write_raw", &ext::write_vector_raw_attr<long long>,
            py::arg("data"),
-           "No dimensionality checks will be performed")
+           "No dimensionality checks will be performed",
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_vector_raw_attr<double>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_vector_raw_attr<std::complex<double>>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
 //      .def("write_raw", &ext::write_vector_raw_attr<const char*>,  // without any error it doesn't write anything. Doesn't work
 //           py::arg("data"))
 
       // write_eigen_raw_attr
       .def("write_raw", &ext::write_eigen_raw_attr<bool>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<char>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<signed char>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<unsigned char>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<short>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<unsigned short>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<int>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<unsigned>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<long long>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<unsigned long long>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<float>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<double>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<std::complex<float>>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
       .def("write_raw", &ext::write_eigen_raw_attr<std::complex<double>>,
-           py::arg("data"))
+           py::arg("data"),
+           py::call_guard<IOGuard>())
 
 
       // READ
-      .def("readBool", &ext::read_eigen_raw_attr<bool>)
-      .def("readChar", &ext::read_eigen_raw_attr<char>)
-      .def("readSChar", &ext::read_eigen_raw_attr<signed char>)
-      .def("readUChar", &ext::read_eigen_raw_attr<unsigned char>)
-      .def("readShort", &ext::read_eigen_raw_attr<short>)
-      .def("readUShort", &ext::read_eigen_raw_attr<unsigned short>)
-      .def("readInt", &ext::read_eigen_raw_attr<int>)
-      .def("readUInt", &ext::read_eigen_raw_attr<unsigned>)
-      .def("readLong", &ext::read_eigen_raw_attr<long>)
-      .def("readULong", &ext::read_eigen_raw_attr<unsigned long>)
-      .def("readLLong", &ext::read_eigen_raw_attr<long long>)
-      .def("readULLong", &ext::read_eigen_raw_attr<unsigned long long>)
-      .def("readFloat", &ext::read_eigen_raw_attr<float>)
-      .def("readDouble", &ext::read_eigen_raw_attr<double>)
-      .def("readCFloat", &ext::read_eigen_raw_attr<std::complex<float>>)
-      .def("readCDouble", &ext::read_eigen_raw_attr<std::complex<double>>)
-      .def("readStr", &ext::read_vector_raw_attr<const char*>);
+      .def("readBool", &ext::read_eigen_raw_attr<bool>,
+           py::call_guard<IOGuard>())
+      .def("readChar", &ext::read_eigen_raw_attr<char>,
+           py::call_guard<IOGuard>())
+      .def("readSChar", &ext::read_eigen_raw_attr<signed char>,
+           py::call_guard<IOGuard>())
+      .def("readUChar", &ext::read_eigen_raw_attr<unsigned char>,
+           py::call_guard<IOGuard>())
+      .def("readShort", &ext::read_eigen_raw_attr<short>,
+           py::call_guard<IOGuard>())
+      .def("readUShort", &ext::read_eigen_raw_attr<unsigned short>,
+           py::call_guard<IOGuard>())
+      .def("readInt", &ext::read_eigen_raw_attr<int>,
+           py::call_guard<IOGuard>())
+      .def("readUInt", &ext::read_eigen_raw_attr<unsigned>,
+           py::call_guard<IOGuard>())
+      .def("readLong", &ext::read_eigen_raw_attr<long>,
+           py::call_guard<IOGuard>())
+      .def("readULong", &ext::read_eigen_raw_attr<unsigned long>,
+           py::call_guard<IOGuard>())
+      .def("readLLong", &ext::read_eigen_raw_attr<long long>,
+           py::call_guard<IOGuard>())
+      .def("readULLong", &ext::read_eigen_raw_attr<unsigned long long>,
+           py::call_guard<IOGuard>())
+      .def("readFloat", &ext::read_eigen_raw_attr<float>,
+           py::call_guard<IOGuard>())
+      .def("readDouble", &ext::read_eigen_raw_attr<double>,
+           py::call_guard<IOGuard>())
+      .def("readCFloat", &ext::read_eigen_raw_attr<std::complex<float>>,
+           py::call_guard<IOGuard>())
+      .def("readCDouble", &ext::read_eigen_raw_attr<std::complex<double>>,
+           py::call_guard<IOGuard>())
+      .def("readStr", &ext::read_vector_raw_attr<const char*>,
+           py::call_guard<IOGuard>());
 }
 
 
@@ -1,7 +1,261 @@
 #include "../../include/h5gtpy/H5DataSet_py.h"
+#include "../../include/h5gtpy/H5SliceTraits_py.h"
 
 namespace h5gtpy {
 
+namespace ext {
+
+/// \brief NumPy index (ints, slices, Ellipsis and one integer or boolean
+/// array) converted to hyperslab `offset`/`count`/`stride` of each
+/// dimension and optional indices `ind` along `axis`
+struct IndexKey {
+  std::vector<size_t> offset, count, stride;
+  std::vector<size_t> ind;
+  bool hasInd = false;
+  size_t axis = 0;
+
+  std::vector<py::ssize_t> memShape;  // shape of the selection
+  std::vector<py::ssize_t> shape;     // shape of the result (ints dropped)
+  std::vector<py::ssize_t> flip;      // result axes of negative steps
+  py::ssize_t indAxis = -1;           // result axis of `ind`
+  bool indFirst = false;  // `ind` is moved to the front as NumPy does
+                          // when array and int indices are not adjacent
+
+  IndexKey(py::object key, const std::vector<size_t>& dims){
+    const size_t nDims = dims.size();
+    py::tuple items = py::isinstance<py::tuple>(key) ?
+          py::reinterpret_borrow<py::tuple>(key) : py::make_tuple(key);
+
+    size_t nKeys = 0;
+    bool hasEllipsis = false;
+    for (auto item : items){
+      if (py::isinstance<py::ellipsis>(item)){
+        if (hasEllipsis)
+          throw py::index_error("an index can only have a single ellipsis ('...')");
+        hasEllipsis = true;
+      } else {
+        nKeys++;
+      }
+    }
+    if (nKeys > nDims)
+      throw py::index_error(
+            "too many indices: dataset is " + std::to_string(nDims) +
+            "-dimensional, but " + std::to_string(nKeys) + " were indexed");
+
+    // advanced (int and array) indices positions to place `ind` as NumPy
+    std::vector<size_t> advanced;
+    size_t d = 0;
+    for (auto item : items){
+      if (py::isinstance<py::ellipsis>(item)){
+        for (size_t i = 0; i < nDims - nKeys; i++)
+          addSlice(py::slice(py::none(), py::none(), py::none()), dims[d++]);
+        continue;
+      }
+      if (isArray(item)){
+        addArray(item, dims[d]);
+        advanced.push_back(d);
+      } else if (py::isinstance<py::slice>(item)){
+        addSlice(py::reinterpret_borrow<py::slice>(item), dims[d]);
+      } else if (PyIndex_Check(item.ptr()) && !py::isinstance<py::bool_>(item)){
+        addInt(item, dims[d]);
+        advanced.push_back(d);
+      } else {
+        throw py::index_error(
+              "only integers, slices (`:`), ellipsis (`...`) and "
+              "integer or boolean arrays are valid indices");
+      }
+      d++;
+    }
+    while (d < nDims)
+      addSlice(py::slice(py::none(), py::none(), py::none()), dims[d++]);
+
+    if (hasInd && advanced.back() - advanced.front() + 1 != advanced.size())
+      indFirst = true;
+  }
+
+  /// \brief hyperslab or (coalesced) indices selection
+  template <typename Derivate>
+  Selection select(const SliceTraits<Derivate>& slice) const {
+    if (hasInd)
+      return slice.select_along(axis, ind, offset, count, stride);
+    return slice.select(offset, count, stride);
+  }
+
+  size_t getMemSize() const {
+    size_t n = 1;
+    for (auto s : memShape)
+      n *= static_cast<size_t>(s);
+    return n;
+  }
+
+private:
+  static bool isArray(py::handle item){
+    return py::isinstance<py::list>(item) ||
+        (py::isinstance<py::array>(item) &&
+         py::reinterpret_borrow<py::array>(item).ndim() > 0);
+  }
+
+  void addInt(py::handle item, size_t n){
+    py::ssize_t i = item.cast<py::ssize_t>();
+    if (i < 0)
+      i += static_cast<py::ssize_t>(n);
+    if (i < 0 || static_cast<size_t>(i) >= n)
+      throw py::index_error(
+            "index " + std::string(py::str(item)) +
+            " is out of bounds for axis with size " + std::to_string(n));
+    offset.push_back(static_cast<size_t>(i));
+    count.push_back(1);
+    stride.push_back(1);
+    memShape.push_back(1);
+  }
+
+  void addSlice(const py::slice& item, size_t n){
+    py::ssize_t start, stop, step, length;
+    item.compute(static_cast<py::ssize_t>(n), &start, &stop, &step, &length);
+    if (step < 0){
+      // read ascending and flip
+      start += (length - 1) * step;
+      step = -step;
+      flip.push_back(static_cast<py::ssize_t>(shape.size()));
+    }
+    offset.push_back(length > 0 ? static_cast<size_t>(start) : 0);
+    count.push_back(static_cast<size_t>(length));
+    stride.push_back(static_cast<size_t>(step));
+    memShape.push_back(length);
+    shape.push_back(length);
+  }
+
+  void addArray(py::handle item, size_t n){
+    if (hasInd)
+      throw py::index_error("only one integer array index is supported");
+    py::array arr = py::array::ensure(item);
+    if (!arr || arr.ndim() != 1)
+      throw py::index_error("only one-dimensional index arrays are supported");
+
+    const char kind = arr.dtype().kind();
+    if (kind == 'b'){
+      if (static_cast<size_t>(arr.size()) != n)
+        throw py::index_error(
+              "boolean index has " + std::to_string(arr.size()) +
+              " elements while axis has size " + std::to_string(n));
+      arr = py::reinterpret_borrow<py::tuple>(arr.attr("nonzero")())[0];
+    } else if (kind != 'i' && kind != 'u' && arr.size() > 0){
+      throw py::index_error("arrays used as indices must be of integer (or boolean) type");
+    }
+
+    auto idx = py::array_t<long long, py::array::c_style | py::array::forcecast>::ensure(arr);
+    const long long* data = idx.data();
+    for (py::ssize_t k = 0; k < idx.size(); k++){
+      long long i = data[k] < 0 ? data[k] + static_cast<long long>(n) : data[k];
+      if (i < 0 || static_cast<size_t>(i) >= n)
+        throw py::index_error(
+              "index " + std::to_string(data[k]) +
+              " is out of bounds for axis with size " + std::to_string(n));
+      ind.push_back(static_cast<size_t>(i));
+    }
+
+    hasInd = true;
+    axis = offset.size();
+    indAxis = static_cast<py::ssize_t>(shape.size());
+    offset.push_back(0);
+    count.push_back(n);
+    stride.push_back(1);
+    memShape.push_back(static_cast<py::ssize_t>(ind.size()));
+    shape.push_back(static_cast<py::ssize_t>(ind.size()));
+  }
+};
+
+inline py::tuple to_tuple(const std::vector<py::ssize_t>& v){
+  py::tuple t(v.size());
+  for (size_t i = 0; i < v.size(); i++)
+    t[i] = py::int_(v[i]);
+  return t;
+}
+
+/// \brief `dset[key]`: read the indexed elements directly to NumPy array
+/// of the dataset native dtype
+inline py::object getitem(const DataSet& self, py::object key){
+  std::vector<size_t> dims;
+  std::unique_ptr<ArrayElement> element;
+  {
+    IOGuard guard;
+    dims = self.getDimensions();
+    element.reset(new ArrayElement(self.getDataType()));
+  }
+  const IndexKey idx(key, dims);
+
+  py::array arr(element->getDtype(), idx.memShape);
+  if (idx.getMemSize() > 0){
+    char* buffer = static_cast<char*>(arr.mutable_data());
+    IOGuard guard;
+    if (dims.empty())
+      self.read(buffer, element->getDataType());
+    else
+      idx.select(self).read(buffer, element->getDataType());
+  }
+
+  py::module_ np = py::module_::import("numpy");
+  py::object res = arr.attr("reshape")(to_tuple(idx.shape));
+  if (!idx.flip.empty())
+    res = np.attr("flip")(res, to_tuple(idx.flip));
+  if (idx.indFirst)
+    res = np.attr("moveaxis")(res, idx.indAxis, 0);
+  if (idx.shape.empty())
+    return res[py::tuple()];
+  return res;
+}
+
+/// \brief `dset[key] = value`: broadcast `value` to the indexed shape
+/// and write it. Duplicated indices are written in the given order
+inline void setitem(DataSet& self, py::object key, py::object value){
+  std::vector<size_t> dims;
+  {
+    IOGuard guard;
+    dims = self.getDimensions();
+  }
+  const IndexKey idx(key, dims);
+
+  py::array arr = py::array::ensure(value);
+  if (!arr)
+    throw py::type_error("Unable to convert value to numpy array");
+
+  py::module_ np = py::module_::import("numpy");
+  py::object v = np.attr("broadcast_to")(arr, to_tuple(idx.shape));
+  if (idx.indFirst)
+    v = np.attr("moveaxis")(v, 0, idx.indAxis);
+  if (!idx.flip.empty())
+    v = np.attr("flip")(v, to_tuple(idx.flip));
+  arr = py::array::ensure(
+        np.attr("ascontiguousarray")(v.attr("reshape")(to_tuple(idx.memShape))),
+        py::array::c_style);
+  if (idx.getMemSize() == 0)
+    return;
+
+  const ArrayElement element(arr.dtype());
+  const char* buffer = static_cast<const char*>(arr.data());
+  IOGuard guard;
+  if (dims.empty())
+    self.write_raw(buffer, element.getDataType());
+  else
+    idx.select(self).write_raw(buffer, element.getDataType());
+}
+
+} // ext
+
+
+void ChunkInfo_py(py::class_<ChunkInfo> &py_obj){
+  py_obj
+      .def("getOffset", &ChunkInfo::getOffset,
+           "logical offset of the chunk (in elements)")
+      .def("getAddress", &ChunkInfo::getAddress,
+           "address of the chunk within its file")
+      .def("getStorageSize", &ChunkInfo::getStorageSize,
+           "stored (i.e. compressed) size of the chunk in bytes")
+      .def("getFilterMask", &ChunkInfo::getFilterMask,
+           "bit `i` is set if filter `i` was skipped for this chunk")
+      .def("isAllocated", &ChunkInfo::isAllocated);
+}
+
 void DataSet_py(py::class_<DataSet, Object, SliceTraits<DataSet>, AnnotateTraits<DataSet> > &py_obj){
   py_obj
       .def("getStorageSize", &DataSet::getStorageSize,
@@ -23,10 +277,10 @@ void DataSet_py(py::class_<DataSet, Object, SliceTraits<DataSet>, AnnotateTraits
       .def("unlink", &DataSet::unlink)
       .def("rename", &DataSet::rename,
            py::arg("destPath"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"))
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"))
       .def("getParent", &DataSet::getParent,
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"))
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"))
       .def("getCreateProps", &DataSet::getCreateProps)
       .def("getAccessProps", &DataSet::getAccessProps)
       .def("resize", &DataSet::resize,
@@ -39,6 +293,32 @@ void DataSet_py(py::class_<DataSet, Object, SliceTraits<DataSet>, AnnotateTraits
       .def("getElementCount", &DataSet::getElementCount,
            "Get the total number of elements in the current dataset."
 "E.g. 2x2x2 matrix has size 8. This is a shorthand for getSpace().getTotalCount()")
+      .def("getNumberChunks", &DataSet::getNumberChunks,
+           "Number of allocated chunks")
+      .def("listChunks", &DataSet::listChunks,
+           py::arg_v("storageOrder", false, "False"),
+           "List allocated chunks sorted by address in file (storageOrder) "
+"or in logical order")
+      .def("forEachChunkBlock", [](const DataSet& self,
+           const std::function<void(const Selection&, const ChunkInfo&)>& func,
+           bool storageOrder) {
+        self.forEachChunkBlock(func, storageOrder);
+      },
+           py::arg("func"),
+           py::arg_v("storageOrder", true, "True"),
+           "Call `func(sel, info)` for each chunk of the dataset "
+"(unallocated chunks go last if storageOrder is True)")
+      .def("__getitem__", &ext::getitem,
+           py::arg("key"),
+           "Read elements indexed by ints, slices (negative steps too), Ellipsis "
+"and one integer or boolean array (unordered and duplicated indices allowed) "
+"to numpy array of the dataset native dtype. The whole index is read "
+"as one hyperslab selection")
+      .def("__setitem__", &ext::setitem,
+           py::arg("key"),
+           py::arg("value"),
+           "Write `value` broadcasted to the shape of indexed elements "
+"(see `__getitem__`)")
       .def_static("FromId", &DataSet::FromId,
                   py::arg("id"),
                   py::arg_v("increaseRefCount", false, "false"),
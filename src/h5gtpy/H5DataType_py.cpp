@@ -1,7 +1,31 @@
 #include "../../include/h5gtpy/H5DataType_py.h"
+#include "../../include/h5gtpy/H5SliceTraits_py.h"
 
 namespace h5gtpy {
 
+namespace ext {
+
+py::dtype toNumpy(const DataType& self){
+  std::unique_ptr<ArrayElement> element;
+  {
+    IOGuard guard;
+    element.reset(new ArrayElement(self));
+  }
+  return element->getDtype();
+}
+
+CompoundType compoundFromNumpy(const py::dtype& dtype){
+  const ArrayElement element(dtype);
+  if (element.kind != ArrayElement::Kind::Compound)
+    throw py::type_error("Structured numpy dtype expected, got: " +
+                         std::string(py::str(dtype)));
+  IOGuard guard;
+  return CompoundType::FromId(element.getDataType().getId(true));
+}
+
+
+} // ext
+
 void DataType_py(py::class_<DataType, Object>& py_obj){
   py_obj
       .def(py::init<>())
@@ -25,6 +49,10 @@ void DataType_py(py::class_<DataType, Object>& py_obj){
            "Check the DataType was default constructed. Such value might represent auto-detection of the datatype from a buffer")
       .def("isReference", &DataType::isReference,
            "Returns whether the type is a Reference")
+      .def("toNumpy", &ext::toNumpy,
+           "Numpy dtype of the native memory layout of the type: numbers, "
+"fixed length strings, arrays and compound types (structured dtype "
+"with the same offsets and padding)")
       .def_static("FromId", &DataType::FromId,
                   py::arg("id"),
                   py::arg_v("increaseRefCount", false, "false"),
@@ -53,6 +81,10 @@ void CompoundType_py(py::class_<CompoundType, DataType>& py_obj) {
       .def("commit", &CompoundType::commit,
            py::arg("object"),
            py::arg("name"))
+      .def_static("fromNumpy", &ext::compoundFromNumpy,
+                  py::arg("dtype"),
+                  "Create compound type from structured numpy dtype "
+"keeping its field offsets and item size")
       .def("getMembers", &CompoundType::getMembers);
 }
 
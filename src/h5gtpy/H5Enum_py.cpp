@@ -77,5 +77,46 @@ void Endian_py(py::enum_<Endian> &py_obj) {
       .export_values();
 }
 
+void FileSpaceStrategy_py(py::enum_<H5F_fspace_strategy_t> &py_obj) {
+  py_obj
+      .value("FSM_AGGR", H5F_FSPACE_STRATEGY_FSM_AGGR)
+      .value("PAGE", H5F_FSPACE_STRATEGY_PAGE)
+      .value("AGGR", H5F_FSPACE_STRATEGY_AGGR)
+      .value("NONE", H5F_FSPACE_STRATEGY_NONE);
+}
+
+void LibVersion_py(py::enum_<H5F_libver_t> &py_obj) {
+  py_obj
+      .value("EARLIEST", H5F_LIBVER_EARLIEST)
+      .value("V18", H5F_LIBVER_V18)
+      .value("V110", H5F_LIBVER_V110)
+#if H5_VERSION_GE(1, 12, 0)
+      .value("V112", H5F_LIBVER_V112)
+#endif
+      .value("LATEST", H5F_LIBVER_LATEST);
+}
+
+void ScaleOffsetType_py(py::enum_<H5Z_SO_scale_type_t> &py_obj) {
+  py_obj
+      .value("FLOAT_DSCALE", H5Z_SO_FLOAT_DSCALE)
+      .value("FLOAT_ESCALE", H5Z_SO_FLOAT_ESCALE)
+      .value("INT", H5Z_SO_INT);
+}
+
+void AllocTime_py(py::enum_<H5D_alloc_time_t> &py_obj) {
+  py_obj
+      .value("DEFAULT", H5D_ALLOC_TIME_DEFAULT)
+      .value("EARLY", H5D_ALLOC_TIME_EARLY)
+      .value("LATE", H5D_ALLOC_TIME_LATE)
+      .value("INCR", H5D_ALLOC_TIME_INCR);
+}
+
+void FillTime_py(py::enum_<H5D_fill_time_t> &py_obj) {
+  py_obj
+      .value("ALLOC", H5D_FILL_TIME_ALLOC)
+      .value("NEVER", H5D_FILL_TIME_NEVER)
+      .value("IFSET", H5D_FILL_TIME_IFSET);
+}
+
 
 } // h5gtpy
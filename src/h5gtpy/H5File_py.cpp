@@ -2,16 +2,45 @@
 
 namespace h5gtpy {
 
+namespace ext {
+
+std::tuple<size_t, size_t, size_t, int> getMdcSize(
+    const File& self){
+  size_t maxSize;
+  size_t minCleanSize;
+  size_t curSize;
+  int curNumEntries;
+  self.getMdcSize(maxSize, minCleanSize, curSize, curNumEntries);
+  return std::make_tuple(std::move(maxSize), std::move(minCleanSize),
+                         std::move(curSize), std::move(curNumEntries));
+}
+
+} // ext
+
 void File_py(py::class_<File, Object, NodeTraits<File>, AnnotateTraits<File> > &py_obj){
   py_obj
       .def(py::init<const std::string&, File::OpenFlag>(),
            py::arg("file_name"),
            py::arg("open_flag"),
-           "Open or create new h5 file")
+           "Open or create new h5 file",
+           py::call_guard<IOGuard>())
+      .def(py::init<const std::string&, File::OpenFlag,
+           const FileAccessProps&, const FileCreateProps&>(),
+           py::arg("file_name"),
+           py::arg("open_flag"),
+           py::arg("fileAccessProps"),
+           py::arg_v("fileCreateProps", FileCreateProps::Default(), "FileCreateProps.Default()"),
+           "Open or create new h5 file (`fileCreateProps` is used only if the file is created)",
+           py::call_guard<IOGuard>())
       .def_static("FromId", &File::FromId,
                   py::arg("id"),
                   py::arg_v("increaseRefCount", false, "false"),
                   "Create new object from ID")
+      .def("getMdcHitRate", &File::getMdcHitRate,
+           "Metadata cache hit rate since the file was opened or stats were reset")
+      .def("resetMdcHitRateStats", &File::resetMdcHitRateStats)
+      .def("getMdcSize", &ext::getMdcSize,
+           "Return: maxSize, minCleanSize, curSize, curNumEntries")
       .def(py::self == py::self)
       .def(py::self != py::self);
 }
@@ -0,0 +1,37 @@
+#include "../../include/h5gtpy/H5Filter_py.h"
+
+namespace h5gtpy {
+
+void FilterInfo_py(py::class_<FilterInfo> &py_obj){
+  py_obj
+      .def("getId", &FilterInfo::getId)
+      .def("getFlags", &FilterInfo::getFlags,
+           "`H5Z_FLAG_MANDATORY` (0) or `H5Z_FLAG_OPTIONAL` (1)")
+      .def("isOptional", &FilterInfo::isOptional)
+      .def("getCdValues", &FilterInfo::getCdValues,
+           "auxiliary data of the filter (i.e. compression level)")
+      .def("getName", &FilterInfo::getName)
+      .def("getFilterConfig", &FilterInfo::getFilterConfig,
+           "bit 0 - encoder is enabled, bit 1 - decoder is enabled");
+}
+
+void Filter_py(py::module_ &m){
+  m.attr("BIT_SHUFFLE_FILTER") = BitShuffleFilter::id;
+  m.attr("DELTA_FILTER") = DeltaFilter::id;
+
+  m.def("registerBitShuffleFilter", &registerFilter<BitShuffleFilter>,
+        "Register h5gt bit shuffle filter (id: `BIT_SHUFFLE_FILTER`)");
+  m.def("registerDeltaFilter", &registerFilter<DeltaFilter>,
+        "Register h5gt delta filter (id: `DELTA_FILTER`)");
+  m.def("unregisterFilter", &unregisterFilter,
+        py::arg("id"));
+  m.def("isFilterAvailable", &isFilterAvailable,
+        py::arg("id"),
+        "Whether the filter is registered");
+  m.def("getFilterConfig", &getFilterConfig,
+        py::arg("id"),
+        "bit 0 - encoder is enabled, bit 1 - decoder is enabled");
+}
+
+
+} // h5gtpy
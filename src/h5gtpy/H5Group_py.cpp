@@ -13,8 +13,8 @@ void unlink(Group& self){
 }
 
 bool rename(Group& self, const std::string& dest_path,
-            const LinkCreateProps& linkCreateProps = LinkCreateProps(),
-            const LinkAccessProps& linkAccessProps = LinkAccessProps()){
+            const LinkCreateProps& linkCreateProps = LinkCreateProps::Default(),
+            const LinkAccessProps& linkAccessProps = LinkAccessProps::Default()){
   return self.rename(dest_path, linkCreateProps, linkAccessProps);
 }
 
@@ -30,10 +30,10 @@ void Group_py(py::class_<Group, Object, NodeTraits<Group>, AnnotateTraits<Group>
       .def("unlink", &ext::unlink)
       .def("rename", &ext::rename,
            py::arg("destPath"),
-           py::arg_v("linkCreateProps", LinkCreateProps(), "LinkCreateProps()"),
-           py::arg_v("linkAccessProps", LinkAccessProps(), "LinkAccessProps()"))
+           py::arg_v("linkCreateProps", LinkCreateProps::Default(), "LinkCreateProps.Default()"),
+           py::arg_v("linkAccessProps", LinkAccessProps::Default(), "LinkAccessProps.Default()"))
       .def("getParent", &Group::getParent,
-           py::arg_v("groupAccessProps", GroupAccessProps(), "GroupAccessProps()"),
+           py::arg_v("groupAccessProps", GroupAccessProps::Default(), "GroupAccessProps.Default()"),
            "returns parent `Group`")
       .def_static("FromId", &Group::FromId,
                   py::arg("id"),
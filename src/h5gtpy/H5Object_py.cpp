@@ -36,7 +36,8 @@ void LinkInfo_py(py::class_<LinkInfo> &py_obj){
 void Object_py(py::class_<Object> &py_obj){
   py_obj
       .def("flush", &Object::flush,
-           py::arg_v("globalScope", false, "False"))
+           py::arg_v("globalScope", false, "False"),
+           py::call_guard<IOGuard>())
       .def("isValid", &Object::isValid)
       .def("refresh", &Object::refresh,
            "Usually you don't need to use it.")
@@ -33,40 +33,177 @@ std::tuple<std::string, off_t, hsize_t> getExternal(
   return std::make_tuple(std::move(fileName), std::move(offset), std::move(fileSize));
 }
 
+std::tuple<size_t, size_t, size_t> getBuffer(
+    DataTransferProps& self){
+  size_t size;
+  void* tconv;
+  void* bkg;
+  self.getBuffer(size, tconv, bkg);
+  return std::make_tuple(
+        std::move(size),
+        reinterpret_cast<size_t>(tconv),
+        reinterpret_cast<size_t>(bkg));
+}
+
+std::tuple<H5F_fspace_strategy_t, bool, hsize_t> getFileSpaceStrategy(
+    FileCreateProps& self){
+  H5F_fspace_strategy_t strategy;
+  bool persist;
+  hsize_t threshold;
+  self.getFileSpaceStrategy(strategy, persist, threshold);
+  return std::make_tuple(std::move(strategy), std::move(persist), std::move(threshold));
+}
+
+std::tuple<size_t, unsigned, unsigned> getPageBufferSize(
+    FileAccessProps& self){
+  size_t size;
+  unsigned minMetaPerc;
+  unsigned minRawPerc;
+  self.getPageBufferSize(size, minMetaPerc, minRawPerc);
+  return std::make_tuple(std::move(size), std::move(minMetaPerc), std::move(minRawPerc));
+}
+
+std::tuple<hsize_t, hsize_t> getAlignment(
+    FileAccessProps& self){
+  hsize_t threshold;
+  hsize_t alignment;
+  self.getAlignment(threshold, alignment);
+  return std::make_tuple(std::move(threshold), std::move(alignment));
+}
+
+std::tuple<H5F_libver_t, H5F_libver_t> getLibverBounds(
+    FileAccessProps& self){
+  H5F_libver_t low;
+  H5F_libver_t high;
+  self.getLibverBounds(low, high);
+  return std::make_tuple(std::move(low), std::move(high));
+}
+
+std::tuple<size_t, size_t, size_t> getMdcSize(
+    FileAccessProps& self){
+  size_t initSize;
+  size_t minSize;
+  size_t maxSize;
+  self.getMdcSize(initSize, minSize, maxSize);
+  return std::make_tuple(std::move(initSize), std::move(minSize), std::move(maxSize));
+}
+
+std::tuple<bool, bool, int> getMdcImageConfig(
+    FileAccessProps& self){
+  bool generateImage;
+  bool saveResizeStatus;
+  int entryAgeout;
+  self.getMdcImageConfig(generateImage, saveResizeStatus, entryAgeout);
+  return std::make_tuple(std::move(generateImage), std::move(saveResizeStatus), std::move(entryAgeout));
+}
+
+void setBufferSize(
+    DataTransferProps& self, const size_t& size){
+  self.setBuffer(size);
+}
+
 } // ext
 
 
 void LinkCreateProps_py(py::class_<LinkCreateProps, PropertyList<PropertyType::LINK_CREATE> > &py_obj){
   py_obj
       .def(py::init<>())
+      .def_static("Default", &LinkCreateProps::Default,
+                  "Default instance (intermediate groups creation ON)")
       .def("setCreateIntermediateGroup", &LinkCreateProps::setCreateIntermediateGroup);
 }
 
 void LinkAccessProps_py(py::class_<LinkAccessProps, PropertyList<PropertyType::LINK_ACCESS> > &py_obj){
   py_obj
       .def(py::init<>())
+      .def_static("Default", &LinkAccessProps::Default,
+                  "Shared read-only instance used as default argument")
       .def("setExternalLinkPrefix", &LinkAccessProps::setExternalLinkPrefix,
            py::arg("prefix"));
 }
 
 void FileCreateProps_py(py::class_<FileCreateProps, PropertyList<PropertyType::FILE_CREATE> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &FileCreateProps::Default,
+                  "Shared read-only instance used as default argument")
+      .def("setFileSpaceStrategy", &FileCreateProps::setFileSpaceStrategy,
+           py::arg("strategy"),
+           py::arg_v("persist", false, "False"),
+           py::arg_v("threshold", 1, "1"),
+           "Paged aggregation (`FileSpaceStrategy.PAGE`) allows to use page buffer")
+      .def("getFileSpaceStrategy", &ext::getFileSpaceStrategy,
+           "Return: strategy, persist, threshold")
+      .def("setFileSpacePageSize", &FileCreateProps::setFileSpacePageSize,
+           py::arg("size"))
+      .def("getFileSpacePageSize", &FileCreateProps::getFileSpacePageSize);
 }
 
 void FileAccessProps_py(py::class_<FileAccessProps, PropertyList<PropertyType::FILE_ACCESS> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &FileAccessProps::Default,
+                  "Shared read-only instance used as default argument")
+      .def("setPageBufferSize", &FileAccessProps::setPageBufferSize,
+           py::arg("size"),
+           py::arg_v("minMetaPerc", 0, "0"),
+           py::arg_v("minRawPerc", 0, "0"),
+           "Page buffer may only be used with files created with paged aggregation")
+      .def("getPageBufferSize", &ext::getPageBufferSize,
+           "Return: size, minMetaPerc, minRawPerc")
+      .def("setAlignment", &FileAccessProps::setAlignment,
+           py::arg("threshold"),
+           py::arg("alignment"))
+      .def("getAlignment", &ext::getAlignment,
+           "Return: threshold, alignment")
+      .def("setMetaBlockSize", &FileAccessProps::setMetaBlockSize,
+           py::arg("size"))
+      .def("getMetaBlockSize", &FileAccessProps::getMetaBlockSize)
+      .def("setSmallDataBlockSize", &FileAccessProps::setSmallDataBlockSize,
+           py::arg("size"))
+      .def("getSmallDataBlockSize", &FileAccessProps::getSmallDataBlockSize)
+      .def("setSieveBufSize", &FileAccessProps::setSieveBufSize,
+           py::arg("size"))
+      .def("getSieveBufSize", &FileAccessProps::getSieveBufSize)
+      .def("setLibverBounds", &FileAccessProps::setLibverBounds,
+           py::arg("low"),
+           py::arg("high"))
+      .def("getLibverBounds", &ext::getLibverBounds,
+           "Return: low, high")
+      .def("setMdcSize", &FileAccessProps::setMdcSize,
+           py::arg("initSize"),
+           py::arg("minSize"),
+           py::arg("maxSize"),
+           "Set metadata cache initial, minimum and maximum size in bytes")
+      .def("getMdcSize", &ext::getMdcSize,
+           "Return: initSize, minSize, maxSize")
+      .def("setMdcAutoResize", &FileAccessProps::setMdcAutoResize,
+           py::arg("enable"))
+      .def("getMdcAutoResize", &FileAccessProps::getMdcAutoResize)
+      .def("setMdcImageConfig", &FileAccessProps::setMdcImageConfig,
+           py::arg("generateImage"),
+           py::arg_v("saveResizeStatus", false, "False"),
+           py::arg_v("entryAgeout", H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, "-1"),
+           "Write metadata cache image on close so that the next open warm-starts the cache")
+      .def("getMdcImageConfig", &ext::getMdcImageConfig,
+           "Return: generateImage, saveResizeStatus, entryAgeout")
+      .def("setEvictOnClose", &FileAccessProps::setEvictOnClose,
+           py::arg("evict"))
+      .def("getEvictOnClose", &FileAccessProps::getEvictOnClose);
 }
 
 void GroupCreateProps_py(py::class_<GroupCreateProps, PropertyList<PropertyType::GROUP_CREATE> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &GroupCreateProps::Default,
+                  "Shared read-only instance used as default argument");
 }
 
 void GroupAccessProps_py(py::class_<GroupAccessProps, PropertyList<PropertyType::GROUP_ACCESS> > &py_obj){
   py_obj
       .def(py::init<>())
+      .def_static("Default", &GroupAccessProps::Default,
+                  "Shared read-only instance used as default argument")
       .def("setExternalLinkPrefix", &GroupAccessProps::setExternalLinkPrefix,
            py::arg("prefix"));
 }
@@ -74,6 +211,8 @@ void GroupAccessProps_py(py::class_<GroupAccessProps, PropertyList<PropertyType:
 void DataSetCreateProps_py(py::class_<DataSetCreateProps, PropertyList<PropertyType::DATASET_CREATE> > &py_obj){
   py_obj
       .def(py::init<>())
+      .def_static("Default", &DataSetCreateProps::Default,
+                  "Shared read-only instance used as default argument")
       .def_static("FromId", &DataSetCreateProps::FromId,
                   py::arg("id"),
                   py::arg_v("increaseRefCount", false, "false"),
@@ -87,6 +226,31 @@ void DataSetCreateProps_py(py::class_<DataSetCreateProps, PropertyList<PropertyT
            py::arg("srcDset"),
            py::arg("srcSpace"))
       .def("setShuffle", &DataSetCreateProps::setShuffle)
+      .def("setDeflate", &DataSetCreateProps::setDeflate,
+           py::arg("level"))
+      .def("setFilter", &DataSetCreateProps::setFilter,
+           py::arg("id"),
+           py::arg_v("flags", H5Z_FLAG_MANDATORY, "0"),
+           py::arg_v("cdValues", std::vector<unsigned>(), "[]"),
+           "Append registered filter to the pipeline (flags: 0 - mandatory, 1 - optional)")
+      .def("setScaleOffset", &DataSetCreateProps::setScaleOffset,
+           py::arg("scaleType"),
+           py::arg("scaleFactor"))
+      .def("setNBit", &DataSetCreateProps::setNBit)
+      .def("setFletcher32", &DataSetCreateProps::setFletcher32)
+      .def("removeFilter", &DataSetCreateProps::removeFilter,
+           py::arg("id"))
+      .def("getFilterCount", &DataSetCreateProps::getFilterCount)
+      .def("getFilters", &DataSetCreateProps::getFilters,
+           "Filters in the order they are applied when writing")
+      .def("hasFilter", &DataSetCreateProps::hasFilter,
+           py::arg("id"))
+      .def("setAllocTime", &DataSetCreateProps::setAllocTime,
+           py::arg("allocTime"))
+      .def("getAllocTime", &DataSetCreateProps::getAllocTime)
+      .def("setFillTime", &DataSetCreateProps::setFillTime,
+           py::arg("fillTime"))
+      .def("getFillTime", &DataSetCreateProps::getFillTime)
       .def("setChunk", &ext::setChunk_wrap1,
            py::arg("dims"))
       .def("setChunk", &ext::setChunk_wrap2,
@@ -116,6 +280,8 @@ void DataSetCreateProps_py(py::class_<DataSetCreateProps, PropertyList<PropertyT
 void DataSetAccessProps_py(py::class_<DataSetAccessProps, PropertyList<PropertyType::DATASET_ACCESS> > &py_obj){
   py_obj
       .def(py::init<>())
+      .def_static("Default", &DataSetAccessProps::Default,
+                  "Shared read-only instance used as default argument")
       .def_static("FromId", &DataSetAccessProps::FromId,
                   py::arg("id"),
                   py::arg_v("increaseRefCount", false, "false"),
@@ -131,17 +297,49 @@ void DataSetAccessProps_py(py::class_<DataSetAccessProps, PropertyList<PropertyT
 
 void DataTypeCreateProps_py(py::class_<DataTypeCreateProps, PropertyList<PropertyType::DATATYPE_CREATE> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &DataTypeCreateProps::Default,
+                  "Shared read-only instance used as default argument");
 }
 
 void DataTypeAccessProps_py(py::class_<DataTypeAccessProps, PropertyList<PropertyType::DATATYPE_ACCESS> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &DataTypeAccessProps::Default,
+                  "Shared read-only instance used as default argument");
+}
+
+void DataTransferProps_py(py::class_<DataTransferProps, PropertyList<PropertyType::DATASET_XFER> > &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_static("Default", &DataTransferProps::Default,
+                  "Shared read-only instance used as default argument")
+      .def_static("FromId", &DataTransferProps::FromId,
+                  py::arg("id"),
+                  py::arg_v("increaseRefCount", false, "false"),
+                  "Create new object from ID")
+      .def("setBufferSize", &ext::setBufferSize,
+           py::arg("size"),
+           "Set the size of type conversion and background buffers")
+      .def("getBuffer", &ext::getBuffer,
+           "Return: size, tconv pointer, bkg pointer")
+      .def("getBufferSize", &DataTransferProps::getBufferSize)
+      .def("setHyperVectorSize", &DataTransferProps::setHyperVectorSize,
+           py::arg("size"))
+      .def("getHyperVectorSize", &DataTransferProps::getHyperVectorSize)
+      .def("setEDCCheck", &DataTransferProps::setEDCCheck,
+           py::arg("enable"))
+      .def("getEDCCheck", &DataTransferProps::getEDCCheck)
+      .def("setDataTransform", &DataTransferProps::setDataTransform,
+           py::arg("expression"))
+      .def("getDataTransform", &DataTransferProps::getDataTransform);
 }
 
 void ObjectCopyProps_py(py::class_<ObjectCopyProps, PropertyList<PropertyType::OBJECT_COPY> > &py_obj){
   py_obj
-      .def(py::init<>());
+      .def(py::init<>())
+      .def_static("Default", &ObjectCopyProps::Default,
+                  "Shared read-only instance used as default argument");
 }
 
 
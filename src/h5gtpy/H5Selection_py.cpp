@@ -1,4 +1,5 @@
 #include "../../include/h5gtpy/H5Selection_py.h"
+#include "../../include/h5gtpy/H5SliceTraits_py.h"
 
 namespace h5gtpy {
 
@@ -8,6 +9,22 @@ DataSet& getDataset_selection_wrap(Selection& self) noexcept{
   return self.getDataset();
 }
 
+/// \brief `sel[key]`: read the selection and index it with NumPy
+py::object getitem_selection(Selection& self, py::object key){
+  py::array arr = read_array(self, py::none(), py::none(),
+                             DataTransferProps::Default());
+  return arr[key];
+}
+
+/// \brief `sel[key] = value`: read the selection, assign `value` to
+/// its indexed elements with NumPy and write the whole selection back
+void setitem_selection(Selection& self, py::object key, py::object value){
+  py::array arr = read_array(self, py::none(), py::none(),
+                             DataTransferProps::Default());
+  arr[key] = value;
+  write_array_raw(self, arr, DataTransferProps::Default());
+}
+
 
 } // ext
 
@@ -22,7 +39,15 @@ void Selection_py(py::class_<Selection, SliceTraits<Selection> > &py_obj){
       .def("getDataset", &ext::getDataset_selection_wrap,
            "parent dataset of this selection")
       .def("getDataType", &Selection::getDataType,
-           "return the datatype of the selection");
+           "return the datatype of the selection")
+      .def("__getitem__", &ext::getitem_selection,
+           py::arg("key"),
+           "Read the selection and index it as numpy array")
+      .def("__setitem__", &ext::setitem_selection,
+           py::arg("key"),
+           py::arg("value"),
+           "Read the selection, assign `value` to indexed elements "
+"and write the whole selection back");
 }
 
 
@@ -5,6 +5,7 @@
 #include "../../include/h5gtpy/H5DataType_py.h"
 #include "../../include/h5gtpy/H5Enum_py.h"
 #include "../../include/h5gtpy/H5File_py.h"
+#include "../../include/h5gtpy/H5Filter_py.h"
 #include "../../include/h5gtpy/H5Group_py.h"
 #include "../../include/h5gtpy/H5NodeTraits_py.h"
 #include "../../include/h5gtpy/H5Object_py.h"
@@ -115,6 +116,11 @@ PYBIND11_MODULE(_h5gt, m) {
   auto pyOpenFlag = py::enum_<File::OpenFlag>(m, "OpenFlag", py::arithmetic());
   auto pyEndian = py::enum_<Endian>(m, "Endian", py::arithmetic());
   auto pyDTypeClass = py::enum_<DataTypeClass>(m, "DataTypeClass", py::arithmetic());
+  auto pyFileSpaceStrategy = py::enum_<H5F_fspace_strategy_t>(m, "FileSpaceStrategy");
+  auto pyLibVersion = py::enum_<H5F_libver_t>(m, "LibVersion");
+  auto pyScaleOffsetType = py::enum_<H5Z_SO_scale_type_t>(m, "ScaleOffsetType");
+  auto pyAllocTime = py::enum_<H5D_alloc_time_t>(m, "AllocTime");
+  auto pyFillTime = py::enum_<H5D_fill_time_t>(m, "FillTime");
 
 //  auto pyException = py::class_<Exception, std::exception>(m, "Exception", py::arithmetic());
 //  auto pyLinkType = py::enum_<LinkType>(m, "LinkType", py::arithmetic());
@@ -122,6 +128,9 @@ PYBIND11_MODULE(_h5gt, m) {
 //  auto pyOpenFlag = py::enum_<File::OpenFlag>(m, "OpenFlag", py::arithmetic());
 //  auto pyDTypeClass = py::enum_<DataTypeClass>(m, "DataTypeClass", py::arithmetic());
 
+  // FILTER -> H5Filter_py.cpp
+  auto pyFilterInfo = py::class_<FilterInfo>(m, "FilterInfo");
+
   // PROPERTYLIST -> H5PropertyList_py.cpp
   auto pyLinkCreatePropsBase = py::class_<PropertyList<PropertyType::LINK_CREATE> >(m, "_LinkCreateProps");
   auto pyLinkAccessPropsBase = py::class_<PropertyList<PropertyType::LINK_ACCESS> >(m, "_LinkAccessProps");
@@ -133,6 +142,7 @@ PYBIND11_MODULE(_h5gt, m) {
   auto pyDataSetAccessPropsBase = py::class_<PropertyList<PropertyType::DATASET_ACCESS> >(m, "_DataSetAccessProps");
   auto pyDataTypeCreatePropsBase = py::class_<PropertyList<PropertyType::DATATYPE_CREATE> >(m, "_DataTypeCreateProps");
   auto pyDataTypeAccessPropsBase = py::class_<PropertyList<PropertyType::DATATYPE_ACCESS> >(m, "_DataTypeAccessProps");
+  auto pyDataTransferPropsBase = py::class_<PropertyList<PropertyType::DATASET_XFER> >(m, "_DataTransferProps");
   auto pyObjectCopyPropsBase = py::class_<PropertyList<PropertyType::OBJECT_COPY> >(m, "_ObjectCopyProps");
 
   auto pyLinkCreateProps = py::class_<LinkCreateProps, PropertyList<PropertyType::LINK_CREATE> >(m, "LinkCreateProps");
@@ -145,6 +155,7 @@ PYBIND11_MODULE(_h5gt, m) {
   auto pyDsetAccessProps = py::class_<DataSetAccessProps, PropertyList<PropertyType::DATASET_ACCESS> >(m, "DataSetAccessProps");
   auto pyDTypeCreateProps = py::class_<DataTypeCreateProps, PropertyList<PropertyType::DATATYPE_CREATE> >(m, "DataTypeCreateProps");
   auto pyDTypeAccessProps = py::class_<DataTypeAccessProps, PropertyList<PropertyType::DATATYPE_ACCESS> >(m, "DataTypeAccessProps");
+  auto pyDataTransferProps = py::class_<DataTransferProps, PropertyList<PropertyType::DATASET_XFER> >(m, "DataTransferProps");
   auto pyObjectCopyProps = py::class_<ObjectCopyProps, PropertyList<PropertyType::OBJECT_COPY> >(m, "ObjectCopyProps");
 
 
@@ -218,6 +229,7 @@ PYBIND11_MODULE(_h5gt, m) {
   auto pyGroup = py::class_<Group, Object, NodeTraits<Group>, AnnotateTraits<Group> >(m, "Group");
 
   //DATASET -> H5DataSet_py.cpp
+  auto pyChunkInfo = py::class_<ChunkInfo>(m, "ChunkInfo");
   auto pyDset = py::class_<DataSet, Object, SliceTraits<DataSet>, AnnotateTraits<DataSet> >(m, "DataSet");
 
   //ATTRIBUTE -> H5Attribute_py.cpp
@@ -236,6 +248,15 @@ PYBIND11_MODULE(_h5gt, m) {
   OpenFlag_py(pyOpenFlag);
   Endian_py(pyEndian);
   DataTypeClass_py(pyDTypeClass);
+  FileSpaceStrategy_py(pyFileSpaceStrategy);
+  LibVersion_py(pyLibVersion);
+  ScaleOffsetType_py(pyScaleOffsetType);
+  AllocTime_py(pyAllocTime);
+  FillTime_py(pyFillTime);
+
+  // FILTER -> H5Filter_py.cpp
+  FilterInfo_py(pyFilterInfo);
+  Filter_py(m);
 
   // PROPERTYLIST -> H5PropertyList_py.cpp
   PropertyList_py(pyLinkCreatePropsBase);
@@ -248,6 +269,7 @@ PYBIND11_MODULE(_h5gt, m) {
   PropertyList_py(pyDataSetAccessPropsBase);
   PropertyList_py(pyDataTypeCreatePropsBase);
   PropertyList_py(pyDataTypeAccessPropsBase);
+  PropertyList_py(pyDataTransferPropsBase);
 
   LinkCreateProps_py(pyLinkCreateProps);
   LinkAccessProps_py(pyLinkAccessProps);
@@ -259,6 +281,7 @@ PYBIND11_MODULE(_h5gt, m) {
   DataSetAccessProps_py(pyDsetAccessProps);
   DataTypeCreateProps_py(pyDTypeCreateProps);
   DataTypeAccessProps_py(pyDTypeAccessProps);
+  DataTransferProps_py(pyDataTransferProps);
   ObjectCopyProps_py(pyObjectCopyProps);
 
   // OBJECT -> H5Object_py.cpp
@@ -335,6 +358,7 @@ PYBIND11_MODULE(_h5gt, m) {
   Group_py(pyGroup);
 
   //DATASET -> H5DataSet_py.cpp
+  ChunkInfo_py(pyChunkInfo);
   DataSet_py(pyDset);
 
   //DATASET -> H5DataSet_py.cpp
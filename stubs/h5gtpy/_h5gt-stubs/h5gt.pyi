@@ -5,6 +5,7 @@ import numpy
 _Shape = typing.Tuple[int, ...]
 
 __all__ = [
+    "AllocTime",
     "AtomicBool",
     "AtomicCDouble",
     "AtomicCFloat",
@@ -23,11 +24,15 @@ __all__ = [
     "AtomicULong",
     "AtomicUShort",
     "Attribute",
+    "BIT_SHUFFLE_FILTER",
+    "ChunkInfo",
     "Create",
+    "DELTA_FILTER",
     "DataSet",
     "DataSetAccessProps",
     "DataSetCreateProps",
     "DataSpace",
+    "DataTransferProps",
     "DataType",
     "DataTypeAccessProps",
     "DataTypeClass",
@@ -39,9 +44,13 @@ __all__ = [
     "File",
     "FileAccessProps",
     "FileCreateProps",
+    "FileSpaceStrategy",
+    "FillTime",
+    "FilterInfo",
     "Group",
     "GroupAccessProps",
     "GroupCreateProps",
+    "LibVersion",
     "LinkAccessProps",
     "LinkCreateProps",
     "LinkInfo",
@@ -56,8 +65,14 @@ __all__ = [
     "PropertyType",
     "ReadOnly",
     "ReadWrite",
+    "ScaleOffsetType",
     "Selection",
-    "Truncate"
+    "Truncate",
+    "getFilterConfig",
+    "isFilterAvailable",
+    "registerBitShuffleFilter",
+    "registerDeltaFilter",
+    "unregisterFilter"
 ]
 
 
@@ -115,8 +130,25 @@ class DataType(Object):
         """
         Returns a friendly description of the type (e.g. Float32)
         """
+    def toNumpy(self) -> numpy.dtype: 
+        """
+        Numpy dtype of the native memory layout of the type: numbers, fixed length strings, arrays and compound types (structured dtype with the same offsets and padding)
+        """
     __hash__ = None
     pass
+class CompoundType(DataType, Object):
+    @typing.overload
+    def __init__(self, arg0: CompoundType) -> None: ...
+    @typing.overload
+    def __init__(self, members: typing.Any, size: int = 0) -> None: ...
+    def commit(self, object: Object, name: str) -> None: ...
+    @staticmethod
+    def fromNumpy(dtype: numpy.dtype) -> CompoundType: 
+        """
+        Create compound type from structured numpy dtype keeping its field offsets and item size
+        """
+    def getMembers(self) -> typing.Any: ...
+    pass
 class AtomicCFloat(DataType, Object):
     def __init__(self) -> None: ...
     pass
@@ -315,10 +347,18 @@ class _AnnotateDataSet():
 class _DataSetAccessProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _DataSetCreateProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class DataSpace(Object):
     @staticmethod
@@ -359,9 +399,21 @@ class DataSpace(Object):
 class AtomicBool(DataType, Object):
     def __init__(self) -> None: ...
     pass
+class _DataTransferProps():
+    def getId(self, increaseRefCount: bool = false) -> int: ...
+    def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
+    pass
 class _DataTypeAccessProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class DataTypeClass():
     """
@@ -430,6 +482,10 @@ class DataTypeClass():
 class _DataTypeCreateProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class ElementSet():
     @typing.overload
@@ -471,10 +527,18 @@ class _AnnotateFile():
 class _FileAccessProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _FileCreateProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _AnnotateGroup():
     @typing.overload
@@ -508,18 +572,34 @@ class _AnnotateGroup():
 class _GroupAccessProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _GroupCreateProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _LinkAccessProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class _LinkCreateProps():
     def getId(self, increaseRefCount: bool = false) -> int: ...
     def getObjectType(self) -> PropertyType: ...
+    def isDefault(self) -> bool: 
+        """
+        Whether the object is backed by `H5P_DEFAULT` (can't be modified)
+        """
     pass
 class LinkInfo():
     def creationOrderValid(self) -> bool: ...
@@ -631,6 +711,185 @@ class ObjectType():
     UserDataType: h5gtpy._h5gt.ObjectType # value = <ObjectType.UserDataType: 2>
     __members__: dict # value = {'File': <ObjectType.File: 0>, 'Group': <ObjectType.Group: 1>, 'UserDataType': <ObjectType.UserDataType: 2>, 'DataSpace': <ObjectType.DataSpace: 3>, 'Dataset': <ObjectType.Dataset: 4>, 'Attribute': <ObjectType.Attribute: 5>, 'Other': <ObjectType.Other: 6>}
     pass
+class FileSpaceStrategy():
+    """
+    Members:
+
+      FSM_AGGR
+
+      PAGE
+
+      AGGR
+
+      NONE
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    AGGR: h5gtpy._h5gt.FileSpaceStrategy # value = <FileSpaceStrategy.AGGR: 2>
+    FSM_AGGR: h5gtpy._h5gt.FileSpaceStrategy # value = <FileSpaceStrategy.FSM_AGGR: 0>
+    NONE: h5gtpy._h5gt.FileSpaceStrategy # value = <FileSpaceStrategy.NONE: 3>
+    PAGE: h5gtpy._h5gt.FileSpaceStrategy # value = <FileSpaceStrategy.PAGE: 1>
+    __members__: dict # value = {'FSM_AGGR': <FileSpaceStrategy.FSM_AGGR: 0>, 'PAGE': <FileSpaceStrategy.PAGE: 1>, 'AGGR': <FileSpaceStrategy.AGGR: 2>, 'NONE': <FileSpaceStrategy.NONE: 3>}
+    pass
+class LibVersion():
+    """
+    Members:
+
+      EARLIEST
+
+      V18
+
+      V110
+
+      LATEST
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    EARLIEST: h5gtpy._h5gt.LibVersion # value = <LibVersion.EARLIEST: 0>
+    LATEST: h5gtpy._h5gt.LibVersion # value = <LibVersion.LATEST: 2>
+    V110: h5gtpy._h5gt.LibVersion # value = <LibVersion.V110: 2>
+    V18: h5gtpy._h5gt.LibVersion # value = <LibVersion.V18: 1>
+    __members__: dict # value = {'EARLIEST': <LibVersion.EARLIEST: 0>, 'V18': <LibVersion.V18: 1>, 'V110': <LibVersion.V110: 2>, 'LATEST': <LibVersion.LATEST: 2>}
+    pass
+class AllocTime():
+    """
+    Members:
+
+      DEFAULT
+
+      EARLY
+
+      LATE
+
+      INCR
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    DEFAULT: h5gtpy._h5gt.AllocTime # value = <AllocTime.DEFAULT: 0>
+    EARLY: h5gtpy._h5gt.AllocTime # value = <AllocTime.EARLY: 1>
+    INCR: h5gtpy._h5gt.AllocTime # value = <AllocTime.INCR: 3>
+    LATE: h5gtpy._h5gt.AllocTime # value = <AllocTime.LATE: 2>
+    __members__: dict # value = {'DEFAULT': <AllocTime.DEFAULT: 0>, 'EARLY': <AllocTime.EARLY: 1>, 'LATE': <AllocTime.LATE: 2>, 'INCR': <AllocTime.INCR: 3>}
+    pass
+class FillTime():
+    """
+    Members:
+
+      ALLOC
+
+      NEVER
+
+      IFSET
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    ALLOC: h5gtpy._h5gt.FillTime # value = <FillTime.ALLOC: 0>
+    IFSET: h5gtpy._h5gt.FillTime # value = <FillTime.IFSET: 2>
+    NEVER: h5gtpy._h5gt.FillTime # value = <FillTime.NEVER: 1>
+    __members__: dict # value = {'ALLOC': <FillTime.ALLOC: 0>, 'NEVER': <FillTime.NEVER: 1>, 'IFSET': <FillTime.IFSET: 2>}
+    pass
+class ScaleOffsetType():
+    """
+    Members:
+
+      FLOAT_DSCALE
+
+      FLOAT_ESCALE
+
+      INT
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    FLOAT_DSCALE: h5gtpy._h5gt.ScaleOffsetType # value = <ScaleOffsetType.FLOAT_DSCALE: 0>
+    FLOAT_ESCALE: h5gtpy._h5gt.ScaleOffsetType # value = <ScaleOffsetType.FLOAT_ESCALE: 1>
+    INT: h5gtpy._h5gt.ScaleOffsetType # value = <ScaleOffsetType.INT: 2>
+    __members__: dict # value = {'FLOAT_DSCALE': <ScaleOffsetType.FLOAT_DSCALE: 0>, 'FLOAT_ESCALE': <ScaleOffsetType.FLOAT_ESCALE: 1>, 'INT': <ScaleOffsetType.INT: 2>}
+    pass
 class OpenFlag():
     """
     Members:
@@ -680,7 +939,27 @@ class OpenFlag():
         """
         :type: int
         """
-    Create: h5gtpy._h5gt.OpenFlag # value = <OpenFlag.Create: 16>
+    def getFilterConfig(id: int) -> int:
+    """
+    bit 0 - encoder is enabled, bit 1 - decoder is enabled
+    """
+def isFilterAvailable(id: int) -> bool:
+    """
+    Whether the filter is registered
+    """
+def registerBitShuffleFilter() -> None:
+    """
+    Register h5gt bit shuffle filter (id: `BIT_SHUFFLE_FILTER`)
+    """
+def registerDeltaFilter() -> None:
+    """
+    Register h5gt delta filter (id: `DELTA_FILTER`)
+    """
+def unregisterFilter(id: int) -> None:
+    pass
+BIT_SHUFFLE_FILTER = 311
+Create: h5gtpy._h5gt.OpenFlag # value = <OpenFlag.Create: 16>
+DELTA_FILTER = 312
     Debug: h5gtpy._h5gt.OpenFlag # value = <OpenFlag.Debug: 8>
     Excl: h5gtpy._h5gt.OpenFlag # value = <OpenFlag.Excl: 4>
     OpenOrCreate: h5gtpy._h5gt.OpenFlag # value = <OpenFlag.OpenOrCreate: 17>
@@ -770,232 +1049,100 @@ class PropertyType():
     __members__: dict # value = {'OBJECT_CREATE': <PropertyType.OBJECT_CREATE: 0>, 'FILE_CREATE': <PropertyType.FILE_CREATE: 1>, 'FILE_ACCESS': <PropertyType.FILE_ACCESS: 2>, 'DATASET_CREATE': <PropertyType.DATASET_CREATE: 3>, 'DATASET_ACCESS': <PropertyType.DATASET_ACCESS: 4>, 'DATASET_XFER': <PropertyType.DATASET_XFER: 5>, 'GROUP_CREATE': <PropertyType.GROUP_CREATE: 6>, 'GROUP_ACCESS': <PropertyType.GROUP_ACCESS: 7>, 'DATATYPE_CREATE': <PropertyType.DATATYPE_CREATE: 8>, 'DATATYPE_ACCESS': <PropertyType.DATATYPE_ACCESS: 9>, 'STRING_CREATE': <PropertyType.STRING_CREATE: 10>, 'ATTRIBUTE_CREATE': <PropertyType.ATTRIBUTE_CREATE: 11>, 'OBJECT_COPY': <PropertyType.OBJECT_COPY: 12>, 'LINK_CREATE': <PropertyType.LINK_CREATE: 13>, 'LINK_ACCESS': <PropertyType.LINK_ACCESS: 14>}
     pass
 class _SelectionSlice():
-    def readBool(self) -> numpy.ndarray[bool, _Shape[m, n]]: ...
-    def readCDouble(self) -> numpy.ndarray[numpy.complex128, _Shape[m, n]]: ...
-    def readCFloat(self) -> numpy.ndarray[numpy.complex64, _Shape[m, n]]: ...
-    def readChar(self) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
-    def readDouble(self) -> numpy.ndarray[numpy.float64, _Shape[m, n]]: ...
-    def readFloat(self) -> numpy.ndarray[numpy.float32, _Shape[m, n]]: ...
-    def readInt(self) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
-    def readLLong(self) -> numpy.ndarray[numpy.int64, _Shape[m, n]]: ...
-    def readLong(self) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
-    def readSChar(self) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
-    def readShort(self) -> numpy.ndarray[numpy.int16, _Shape[m, n]]: ...
-    def readStr(self) -> typing.List[str]: ...
-    def readUChar(self) -> numpy.ndarray[numpy.uint8, _Shape[m, n]]: ...
-    def readUInt(self) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
-    def readULLong(self) -> numpy.ndarray[numpy.uint64, _Shape[m, n]]: ...
-    def readULong(self) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
-    def readUShort(self) -> numpy.ndarray[numpy.uint16, _Shape[m, n]]: ...
+    def read(self, out: typing.Optional[numpy.ndarray] = None, dtype: typing.Any = None, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray: 
+        """
+        Read to C-ordered numpy array of selection shape and `dtype` (native dtype of the dataset if None, structured dtype for compound type). If `out` is given it must be C-contiguous writeable array with the same number of elements and it is returned
+        """
+    def readBool(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[bool, _Shape[m, n]]: ...
+    def readCDouble(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.complex128, _Shape[m, n]]: ...
+    def readCFloat(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.complex64, _Shape[m, n]]: ...
+    def readChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
+    def readDouble(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.float64, _Shape[m, n]]: ...
+    def readFloat(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.float32, _Shape[m, n]]: ...
+    def readInt(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
+    def readLLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int64, _Shape[m, n]]: ...
+    def readLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
+    def readSChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
+    def readShort(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int16, _Shape[m, n]]: ...
+    def readStr(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> typing.List[str]: ...
+    def readUChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint8, _Shape[m, n]]: ...
+    def readUInt(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
+    def readULLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint64, _Shape[m, n]]: ...
+    def readULong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
+    def readUShort(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint16, _Shape[m, n]]: ...
     @typing.overload
     def select(self, columns: typing.List[int]) -> Selection: ...
     @typing.overload
     def select(self, elements: ElementSet) -> Selection: ...
     @typing.overload
     def select(self, offset: typing.List[int], count: typing.List[int], stride: typing.List[int] = vector<size_t>()) -> Selection: ...
-    @typing.overload
-    def write(self, arg0: complex) -> None: 
+    def select_along(self, axis: int, ind: typing.List[int], offset: typing.List[int], count: typing.List[int], stride: typing.List[int] = list()) -> Selection: 
         """
-        An exception is raised if the numbers of dimension of the buffer and of the dataset are different
+        Select indices `ind` along `axis` (unordered and duplicated allowed) and `count` elements separated by `stride` starting from `offset` along other dimensions
         """
-    @typing.overload
-    def write(self, arg0: float) -> None: ...
-    @typing.overload
-    def write(self, arg0: int) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[bool, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.complex128, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.complex64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.float32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.float64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: str) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[complex]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[float]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[int]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[str]) -> None: ...
-    @typing.overload
-    def write(self, data: bool) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[bool, _Shape[m, n]]) -> None: 
+    def write(self, data: typing.Any, xferProps: DataTransferProps = DataTransferProps.Default()) -> None: 
         """
-        No dimensionality checks will be performed
+        Write str, list of str, number, list of numbers or numpy array. The memory type is chosen by numpy dtype (structured arrays are written as compound type matched by field names). An exception is raised if the numbers of dimension of the buffer and of the dataset are different. Arrays are written in C order (`readX` return them transposed, use `read`)
+        """
+    def write_raw(self, data: numpy.ndarray, xferProps: DataTransferProps = DataTransferProps.Default()) -> None: 
+        """
+        No dimensionality checks will be performed. C or F contiguous array is written without copying
         """
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.complex128, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.complex64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.float32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.float64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[complex]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[float]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[int]) -> None: ...
     pass
 class _DsetSlice():
-    def readBool(self) -> numpy.ndarray[bool, _Shape[m, n]]: ...
-    def readCDouble(self) -> numpy.ndarray[numpy.complex128, _Shape[m, n]]: ...
-    def readCFloat(self) -> numpy.ndarray[numpy.complex64, _Shape[m, n]]: ...
-    def readChar(self) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
-    def readDouble(self) -> numpy.ndarray[numpy.float64, _Shape[m, n]]: ...
-    def readFloat(self) -> numpy.ndarray[numpy.float32, _Shape[m, n]]: ...
-    def readInt(self) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
-    def readLLong(self) -> numpy.ndarray[numpy.int64, _Shape[m, n]]: ...
-    def readLong(self) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
-    def readSChar(self) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
-    def readShort(self) -> numpy.ndarray[numpy.int16, _Shape[m, n]]: ...
-    def readStr(self) -> typing.List[str]: ...
-    def readUChar(self) -> numpy.ndarray[numpy.uint8, _Shape[m, n]]: ...
-    def readUInt(self) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
-    def readULLong(self) -> numpy.ndarray[numpy.uint64, _Shape[m, n]]: ...
-    def readULong(self) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
-    def readUShort(self) -> numpy.ndarray[numpy.uint16, _Shape[m, n]]: ...
+    def read(self, out: typing.Optional[numpy.ndarray] = None, dtype: typing.Any = None, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray: 
+        """
+        Read to C-ordered numpy array of selection shape and `dtype` (native dtype of the dataset if None, structured dtype for compound type). If `out` is given it must be C-contiguous writeable array with the same number of elements and it is returned
+        """
+    def readBool(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[bool, _Shape[m, n]]: ...
+    def readCDouble(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.complex128, _Shape[m, n]]: ...
+    def readCFloat(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.complex64, _Shape[m, n]]: ...
+    def readChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
+    def readDouble(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.float64, _Shape[m, n]]: ...
+    def readFloat(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.float32, _Shape[m, n]]: ...
+    def readInt(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
+    def readLLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int64, _Shape[m, n]]: ...
+    def readLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int32, _Shape[m, n]]: ...
+    def readSChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int8, _Shape[m, n]]: ...
+    def readShort(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.int16, _Shape[m, n]]: ...
+    def readStr(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> typing.List[str]: ...
+    def readUChar(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint8, _Shape[m, n]]: ...
+    def readUInt(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
+    def readULLong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint64, _Shape[m, n]]: ...
+    def readULong(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint32, _Shape[m, n]]: ...
+    def readUShort(self, xferProps: DataTransferProps = DataTransferProps.Default()) -> numpy.ndarray[numpy.uint16, _Shape[m, n]]: ...
     @typing.overload
     def select(self, columns: typing.List[int]) -> Selection: ...
     @typing.overload
     def select(self, elements: ElementSet) -> Selection: ...
     @typing.overload
     def select(self, offset: typing.List[int], count: typing.List[int], stride: typing.List[int] = vector<size_t>()) -> Selection: ...
-    @typing.overload
-    def write(self, arg0: complex) -> None: 
+    def select_along(self, axis: int, ind: typing.List[int], offset: typing.List[int], count: typing.List[int], stride: typing.List[int] = list()) -> Selection: 
         """
-        An exception is raised if the numbers of dimension of the buffer and of the dataset are different
+        Select indices `ind` along `axis` (unordered and duplicated allowed) and `count` elements separated by `stride` starting from `offset` along other dimensions
         """
-    @typing.overload
-    def write(self, arg0: float) -> None: ...
-    @typing.overload
-    def write(self, arg0: int) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[bool, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.complex128, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.complex64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.float32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.float64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.int8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: numpy.ndarray[numpy.uint8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write(self, arg0: str) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[complex]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[float]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[int]) -> None: ...
-    @typing.overload
-    def write(self, arg0: typing.List[str]) -> None: ...
-    @typing.overload
-    def write(self, data: bool) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[bool, _Shape[m, n]]) -> None: 
+    def write(self, data: typing.Any, xferProps: DataTransferProps = DataTransferProps.Default()) -> None: 
         """
-        No dimensionality checks will be performed
+        Write str, list of str, number, list of numbers or numpy array. The memory type is chosen by numpy dtype (structured arrays are written as compound type matched by field names). An exception is raised if the numbers of dimension of the buffer and of the dataset are different. Arrays are written in C order (`readX` return them transposed, use `read`)
+        """
+    def write_raw(self, data: numpy.ndarray, xferProps: DataTransferProps = DataTransferProps.Default()) -> None: 
+        """
+        No dimensionality checks will be performed. C or F contiguous array is written without copying
         """
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.complex128, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.complex64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.float32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.float64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.int8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint16, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint32, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint64, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: numpy.ndarray[numpy.uint8, _Shape[m, n]]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[complex]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[float]) -> None: ...
-    @typing.overload
-    def write_raw(self, data: typing.List[int]) -> None: ...
     pass
 class _FileNode():
     @typing.overload
-    def createDataSet(self, dset_name: str, dim: int, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
+    def createDataSet(self, dset_name: str, dim: int, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
     @typing.overload
-    def createDataSet(self, dset_name: str, dims: typing.List[int], type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
+    def createDataSet(self, dset_name: str, dims: typing.List[int], type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
     @typing.overload
-    def createDataSet(self, dset_name: str, space: DataSpace, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
-    def createGroup(self, group_name: str, linkCreateProps: LinkCreateProps = LinkCreateProps(), groupCreateProps: GroupCreateProps = GroupCreateProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: 
+    def createDataSet(self, dset_name: str, space: DataSpace, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
+    def createGroup(self, group_name: str, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), groupCreateProps: GroupCreateProps = GroupCreateProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: 
         """
         Create a new group, and eventually intermediate groups
         """
     @typing.overload
-    def createLink(self, dset: DataSet, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: 
+    def createLink(self, dset: DataSet, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: 
         """
         Creates link to a `File`
 
@@ -1004,56 +1151,56 @@ class _FileNode():
         Creates link to a `DataSet`
         """
     @typing.overload
-    def createLink(self, file: File, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: ...
+    def createLink(self, file: File, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: ...
     @typing.overload
-    def createLink(self, group: Group, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: ...
-    def exist(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def createLink(self, group: Group, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: ...
+    def exist(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Check a dataset or group exists in the current node / group
         """
-    def getDataSet(self, dset_name: str, dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: 
+    def getDataSet(self, dset_name: str, dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: 
         """
         Get an existing dataset in the current file
         """
-    def getDataType(self, dtype_name: str, dtypeAccessProps: DataTypeAccessProps = DataTypeAccessProps()) -> DataType: ...
-    def getGroup(self, group_name: str, groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: 
+    def getDataType(self, dtype_name: str, dtypeAccessProps: DataTypeAccessProps = DataTypeAccessProps.Default()) -> DataType: ...
+    def getGroup(self, group_name: str, groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: 
         """
         return the number of leaf objects of the node / group
         """
-    def getLinkType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> LinkType: 
+    def getLinkType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> LinkType: 
         """
         Unlink the given dataset or group. NOTE: unlink doesn't frees memory. Use `h5repack` to free unused space
         """
     def getNumberObjects(self) -> int: ...
-    def getObjectName(self, index: int, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> str: ...
-    def getObjectType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> ObjectType: 
+    def getObjectName(self, index: int, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> str: ...
+    def getObjectType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> ObjectType: 
         """
         A shorthand to get the kind of object pointed to (group, dataset, type...)
         """
-    def hasObject(self, objName: str, objectType: ObjectType, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def hasObject(self, objName: str, objectType: ObjectType, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Advanced version of `exist` that also checks the type of object
         """
     def listObjectNames(self) -> typing.List[str]: ...
-    def rename(self, src_path: str, dest_path: str, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def rename(self, src_path: str, dest_path: str, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Moves an object and its content within an HDF5 file.
         """
-    def unlink(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> None: ...
+    def unlink(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> None: ...
     pass
 class _GroupNode():
     @typing.overload
-    def createDataSet(self, dset_name: str, dim: int, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
+    def createDataSet(self, dset_name: str, dim: int, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
     @typing.overload
-    def createDataSet(self, dset_name: str, dims: typing.List[int], type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
+    def createDataSet(self, dset_name: str, dims: typing.List[int], type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
     @typing.overload
-    def createDataSet(self, dset_name: str, space: DataSpace, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: ...
-    def createGroup(self, group_name: str, linkCreateProps: LinkCreateProps = LinkCreateProps(), groupCreateProps: GroupCreateProps = GroupCreateProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: 
+    def createDataSet(self, dset_name: str, space: DataSpace, type: DataType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), dsetCreateProps: DataSetCreateProps = DataSetCreateProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: ...
+    def createGroup(self, group_name: str, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), groupCreateProps: GroupCreateProps = GroupCreateProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: 
         """
         Create a new group, and eventually intermediate groups
         """
     @typing.overload
-    def createLink(self, dset: DataSet, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: 
+    def createLink(self, dset: DataSet, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: 
         """
         Creates link to a `File`
 
@@ -1062,62 +1209,165 @@ class _GroupNode():
         Creates link to a `DataSet`
         """
     @typing.overload
-    def createLink(self, file: File, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: ...
+    def createLink(self, file: File, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: ...
     @typing.overload
-    def createLink(self, group: Group, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccesProps: LinkAccessProps = LinkAccessProps(), groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: ...
-    def exist(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def createLink(self, group: Group, linkName: str, linkType: LinkType, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccesProps: LinkAccessProps = LinkAccessProps.Default(), groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: ...
+    def exist(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Check a dataset or group exists in the current node / group
         """
-    def getDataSet(self, dset_name: str, dsetAccessProps: DataSetAccessProps = DataSetAccessProps()) -> DataSet: 
+    def getDataSet(self, dset_name: str, dsetAccessProps: DataSetAccessProps = DataSetAccessProps.Default()) -> DataSet: 
         """
         Get an existing dataset in the current file
         """
-    def getDataType(self, dtype_name: str, dtypeAccessProps: DataTypeAccessProps = DataTypeAccessProps()) -> DataType: ...
-    def getGroup(self, group_name: str, groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: 
+    def getDataType(self, dtype_name: str, dtypeAccessProps: DataTypeAccessProps = DataTypeAccessProps.Default()) -> DataType: ...
+    def getGroup(self, group_name: str, groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: 
         """
         return the number of leaf objects of the node / group
         """
-    def getLinkType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> LinkType: 
+    def getLinkType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> LinkType: 
         """
         Unlink the given dataset or group. NOTE: unlink doesn't frees memory. Use `h5repack` to free unused space
         """
     def getNumberObjects(self) -> int: ...
-    def getObjectName(self, index: int, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> str: ...
-    def getObjectType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> ObjectType: 
+    def getObjectName(self, index: int, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> str: ...
+    def getObjectType(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> ObjectType: 
         """
         A shorthand to get the kind of object pointed to (group, dataset, type...)
         """
-    def hasObject(self, objName: str, objectType: ObjectType, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def hasObject(self, objName: str, objectType: ObjectType, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Advanced version of `exist` that also checks the type of object
         """
     def listObjectNames(self) -> typing.List[str]: ...
-    def rename(self, src_path: str, dest_path: str, linkCreateProps: LinkCreateProps = LinkCreateProps(), linkAccessProps: LinkAccessProps = LinkAccessProps()) -> bool: 
+    def rename(self, src_path: str, dest_path: str, linkCreateProps: LinkCreateProps = LinkCreateProps.Default(), linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> bool: 
         """
         Moves an object and its content within an HDF5 file.
         """
-    def unlink(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps()) -> None: ...
+    def unlink(self, obj_name: str, linkAccessProps: LinkAccessProps = LinkAccessProps.Default()) -> None: ...
     pass
 class DataSetAccessProps(_DataSetAccessProps):
+    @staticmethod
+    def Default() -> DataSetAccessProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     def setChunkCache(self, numSlots: int, cacheSize: int, w0: float = static_cast<double>(H5D_CHUNK_CACHE_W0_DEFAULT)) -> None: ...
     def setExternalLinkPrefix(self, prefix: str) -> None: ...
     pass
+class FilterInfo():
+    def getCdValues(self) -> typing.List[int]: 
+        """
+        auxiliary data of the filter (i.e. compression level)
+        """
+    def getFilterConfig(self) -> int: 
+        """
+        bit 0 - encoder is enabled, bit 1 - decoder is enabled
+        """
+    def getFlags(self) -> int: 
+        """
+        `H5Z_FLAG_MANDATORY` (0) or `H5Z_FLAG_OPTIONAL` (1)
+        """
+    def getId(self) -> int: ...
+    def getName(self) -> str: ...
+    def isOptional(self) -> bool: ...
+    pass
 class DataSetCreateProps(_DataSetCreateProps):
+    @staticmethod
+    def Default() -> DataSetCreateProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
+    def getAllocTime(self) -> AllocTime: ...
+    def getFillTime(self) -> FillTime: ...
+    def getFilterCount(self) -> int: ...
+    def getFilters(self) -> typing.List[FilterInfo]: 
+        """
+        Filters in the order they are applied when writing
+        """
+    def hasFilter(self, id: int) -> bool: ...
+    def removeFilter(self, id: int) -> None: ...
+    def setAllocTime(self, allocTime: AllocTime) -> None: ...
     @typing.overload
     def setChunk(self, dim: int) -> None: ...
     @typing.overload
     def setChunk(self, dims: typing.List[int]) -> None: ...
+    def setDeflate(self, level: int) -> None: ...
+    def setFilter(self, id: int, flags: int = 0, cdValues: typing.List[int] = []) -> None: 
+        """
+        Append registered filter to the pipeline (flags: 0 - mandatory, 1 - optional)
+        """
+    def setFillTime(self, fillTime: FillTime) -> None: ...
+    def setFletcher32(self) -> None: ...
+    def setNBit(self) -> None: ...
+    def setScaleOffset(self, scaleType: ScaleOffsetType, scaleFactor: int) -> None: ...
     def setShuffle(self) -> None: ...
     pass
+class DataTransferProps(_DataTransferProps):
+    @staticmethod
+    def Default() -> DataTransferProps: 
+        """
+        Shared read-only instance used as default argument
+        """
+    @staticmethod
+    def FromId(id: int, increaseRefCount: bool = false) -> DataTransferProps: 
+        """
+        Create new object from ID
+        """
+    def __init__(self) -> None: ...
+    def getBuffer(self) -> typing.Tuple[int, int, int]: 
+        """
+        Return: size, tconv pointer, bkg pointer
+        """
+    def getBufferSize(self) -> int: ...
+    def getDataTransform(self) -> str: ...
+    def getEDCCheck(self) -> bool: ...
+    def getHyperVectorSize(self) -> int: ...
+    def setBufferSize(self, size: int) -> None: 
+        """
+        Set the size of type conversion and background buffers
+        """
+    def setDataTransform(self, expression: str) -> None: ...
+    def setEDCCheck(self, enable: bool) -> None: ...
+    def setHyperVectorSize(self, size: int) -> None: ...
+    pass
 class DataTypeAccessProps(_DataTypeAccessProps):
+    @staticmethod
+    def Default() -> DataTypeAccessProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     pass
 class DataTypeCreateProps(_DataTypeCreateProps):
+    @staticmethod
+    def Default() -> DataTypeCreateProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     pass
+class ChunkInfo():
+    def getAddress(self) -> int: 
+        """
+        address of the chunk within its file
+        """
+    def getFilterMask(self) -> int: 
+        """
+        bit `i` is set if filter `i` was skipped for this chunk
+        """
+    def getOffset(self) -> typing.List[int]: 
+        """
+        logical offset of the chunk (in elements)
+        """
+    def getStorageSize(self) -> int: 
+        """
+        stored (i.e. compressed) size of the chunk in bytes
+        """
+    def isAllocated(self) -> bool: ...
+    pass
 class DataSet(Object, _DsetSlice, _AnnotateDataSet):
     @staticmethod
     def FromId(id: int, increaseRefCount: bool = false) -> DataSet: 
@@ -1125,15 +1375,31 @@ class DataSet(Object, _DsetSlice, _AnnotateDataSet):
         Create new object from ID
         """
     def __eq__(self, arg0: DataSet) -> bool: ...
+    def __getitem__(self, key: typing.Any) -> typing.Any: 
+        """
+        Read elements indexed by ints, slices (negative steps too), Ellipsis and one integer or boolean array (unordered and duplicated indices allowed) to numpy array of the dataset native dtype. The whole index is read as one hyperslab selection
+        """
     def __ne__(self, arg0: DataSet) -> bool: ...
+    def __setitem__(self, key: typing.Any, value: typing.Any) -> None: 
+        """
+        Write `value` broadcasted to the shape of indexed elements (see `__getitem__`)
+        """
     def getDimensions(self) -> typing.List[int]: 
         """
         Get the dimensions of the whole DataSet.This is a shorthand for getSpace().getDimensions()
         """
+    def forEachChunkBlock(self, func: typing.Callable[[Selection, ChunkInfo], None], storageOrder: bool = True) -> None: 
+        """
+        Call `func(sel, info)` for each chunk of the dataset (unallocated chunks go last if storageOrder is True)
+        """
     def getElementCount(self) -> int: 
         """
         Get the total number of elements in the current dataset.E.g. 2x2x2 matrix has size 8. This is a shorthand for getSpace().getTotalCount()
         """
+    def getNumberChunks(self) -> int: 
+        """
+        Number of allocated chunks
+        """
     def getLinkInfo(self) -> LinkInfo: 
         """
         return the link info object
@@ -1151,7 +1417,7 @@ class DataSet(Object, _DsetSlice, _AnnotateDataSet):
         """
     @typing.overload
     def getOffset(self) -> int: ...
-    def getParent(self, groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: ...
+    def getParent(self, groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: ...
     def getSpace(self) -> DataSpace: 
         """
         return the dataspace associated with this dataset
@@ -1160,7 +1426,11 @@ class DataSet(Object, _DsetSlice, _AnnotateDataSet):
         """
         returns the amount of storage allocated for a dataset
         """
-    def getTargetPath(self, accessProp: LinkAccessProps = LinkAccessProps()) -> str: 
+    def listChunks(self, storageOrder: bool = False) -> typing.List[ChunkInfo]: 
+        """
+        List allocated chunks sorted by address in file (storageOrder) or in logical order
+        """
+    def getTargetPath(self, accessProp: LinkAccessProps = LinkAccessProps.Default()) -> str: 
         """
         getTargetPath For soft link that returns path to target thatlink points to. Otherwise it works the same way as `getPath()`
         """
@@ -1171,10 +1441,74 @@ class DataSet(Object, _DsetSlice, _AnnotateDataSet):
     __hash__ = None
     pass
 class FileAccessProps(_FileAccessProps):
+    @staticmethod
+    def Default() -> FileAccessProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
+    def getAlignment(self) -> typing.Tuple[int, int]: 
+        """
+        Return: threshold, alignment
+        """
+    def getLibverBounds(self) -> typing.Tuple[LibVersion, LibVersion]: 
+        """
+        Return: low, high
+        """
+    def getEvictOnClose(self) -> bool: ...
+    def getMdcAutoResize(self) -> bool: ...
+    def getMdcImageConfig(self) -> typing.Tuple[bool, bool, int]: 
+        """
+        Return: generateImage, saveResizeStatus, entryAgeout
+        """
+    def getMdcSize(self) -> typing.Tuple[int, int, int]: 
+        """
+        Return: initSize, minSize, maxSize
+        """
+    def getMetaBlockSize(self) -> int: ...
+    def getPageBufferSize(self) -> typing.Tuple[int, int, int]: 
+        """
+        Return: size, minMetaPerc, minRawPerc
+        """
+    def getSieveBufSize(self) -> int: ...
+    def getSmallDataBlockSize(self) -> int: ...
+    def setAlignment(self, threshold: int, alignment: int) -> None: ...
+    def setEvictOnClose(self, evict: bool) -> None: ...
+    def setLibverBounds(self, low: LibVersion, high: LibVersion) -> None: ...
+    def setMdcAutoResize(self, enable: bool) -> None: ...
+    def setMdcImageConfig(self, generateImage: bool, saveResizeStatus: bool = False, entryAgeout: int = -1) -> None: 
+        """
+        Write metadata cache image on close so that the next open warm-starts the cache
+        """
+    def setMdcSize(self, initSize: int, minSize: int, maxSize: int) -> None: 
+        """
+        Set metadata cache initial, minimum and maximum size in bytes
+        """
+    def setMetaBlockSize(self, size: int) -> None: ...
+    def setPageBufferSize(self, size: int, minMetaPerc: int = 0, minRawPerc: int = 0) -> None: 
+        """
+        Page buffer may only be used with files created with paged aggregation
+        """
+    def setSieveBufSize(self, size: int) -> None: ...
+    def setSmallDataBlockSize(self, size: int) -> None: ...
     pass
 class FileCreateProps(_FileCreateProps):
+    @staticmethod
+    def Default() -> FileCreateProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
+    def getFileSpacePageSize(self) -> int: ...
+    def getFileSpaceStrategy(self) -> typing.Tuple[FileSpaceStrategy, bool, int]: 
+        """
+        Return: strategy, persist, threshold
+        """
+    def setFileSpacePageSize(self, size: int) -> None: ...
+    def setFileSpaceStrategy(self, strategy: FileSpaceStrategy, persist: bool = False, threshold: int = 1) -> None: 
+        """
+        Paged aggregation (`FileSpaceStrategy.PAGE`) allows to use page buffer
+        """
     pass
 class File(Object, _FileNode, _AnnotateFile):
     @staticmethod
@@ -1183,22 +1517,47 @@ class File(Object, _FileNode, _AnnotateFile):
         Create new object from ID
         """
     def __eq__(self, arg0: File) -> bool: ...
+    @typing.overload
     def __init__(self, file_name: str, open_flag: OpenFlag) -> None: 
         """
         Open or create new h5 file
         """
+    @typing.overload
+    def __init__(self, file_name: str, open_flag: OpenFlag, fileAccessProps: FileAccessProps, fileCreateProps: FileCreateProps = FileCreateProps.Default()) -> None: 
+        """
+        Open or create new h5 file (`fileCreateProps` is used only if the file is created)
+        """
     def __ne__(self, arg0: File) -> bool: ...
     def flush(self) -> None: 
         """
         Flushes all buffers associated with a file to disk
         """
+    def getMdcHitRate(self) -> float: 
+        """
+        Metadata cache hit rate since the file was opened or stats were reset
+        """
+    def getMdcSize(self) -> typing.Tuple[int, int, int, int]: 
+        """
+        Return: maxSize, minCleanSize, curSize, curNumEntries
+        """
+    def resetMdcHitRateStats(self) -> None: ...
     __hash__ = None
     pass
 class GroupAccessProps(_GroupAccessProps):
+    @staticmethod
+    def Default() -> GroupAccessProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     def setExternalLinkPrefix(self, prefix: str) -> None: ...
     pass
 class GroupCreateProps(_GroupCreateProps):
+    @staticmethod
+    def Default() -> GroupCreateProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     pass
 class Group(Object, _GroupNode, _AnnotateGroup):
@@ -1216,7 +1575,7 @@ class Group(Object, _GroupNode, _AnnotateGroup):
         """
         returns link info object
         """
-    def getParent(self, groupAccessProps: GroupAccessProps = GroupAccessProps()) -> Group: 
+    def getParent(self, groupAccessProps: GroupAccessProps = GroupAccessProps.Default()) -> Group: 
         """
         returns parent `Group`
         """
@@ -1227,14 +1586,32 @@ class Group(Object, _GroupNode, _AnnotateGroup):
     __hash__ = None
     pass
 class LinkAccessProps(_LinkAccessProps):
+    @staticmethod
+    def Default() -> LinkAccessProps: 
+        """
+        Shared read-only instance used as default argument
+        """
     def __init__(self) -> None: ...
     def setExternalLinkPrefix(self, prefix: str) -> None: ...
     pass
 class LinkCreateProps(_LinkCreateProps):
+    @staticmethod
+    def Default() -> LinkCreateProps: 
+        """
+        Default instance (intermediate groups creation ON)
+        """
     def __init__(self) -> None: ...
     def setCreateIntermediateGroup(self, arg0: int) -> None: ...
     pass
 class Selection(_SelectionSlice):
+    def __getitem__(self, key: typing.Any) -> typing.Any: 
+        """
+        Read the selection and index it as numpy array
+        """
+    def __setitem__(self, key: typing.Any, value: typing.Any) -> None: 
+        """
+        Read the selection, assign `value` to indexed elements and write the whole selection back
+        """
     def getDataType(self) -> DataType: 
         """
         return the datatype of the selection
@@ -0,0 +1,47 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+#include <vector>
+
+#include <h5gt/H5AppendableDataSet.hpp>
+#include <h5gt/H5Easy.hpp>
+
+#include "benchmark.hpp"
+
+// Append values one by one to 1D dataset with `H5Easy::dump`
+// (resize + one element write per value) and with AppendableDataSet
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 20000;
+
+  File file("bench_appendable.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  bench::measure("H5Easy::dump (" + std::to_string(n) + " values)", 1, [&](size_t) {
+    for (size_t i = 0; i < n; i++)
+      H5Easy::dump(file, "easy", double(i), {i});
+  });
+
+  bench::measure("AppendableDataSet (" + std::to_string(n) + " values)", 1, [&](size_t) {
+    auto stream = AppendableDataSet<double>::create(file, "appendable");
+    for (size_t i = 0; i < n; i++)
+      stream.append(double(i));
+  });
+
+  // rows of 64 values
+  std::vector<float> row(64);
+  bench::measure("AppendableDataSet (" + std::to_string(n) + " rows of 64)", 1, [&](size_t) {
+    auto rows = AppendableDataSet<float>::create(file, "rows", {row.size()});
+    for (size_t i = 0; i < n; i++) {
+      row[0] = float(i);
+      rows.append(row);
+    }
+  });
+
+  return 0;
+}
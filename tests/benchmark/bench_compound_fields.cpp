@@ -0,0 +1,58 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+
+#include "benchmark.hpp"
+
+// Read one and a few members of a 90 member compound (trace header)
+// table with `readFields` and compare with reading whole records
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 200000;
+  const size_t n_members = 90;
+
+  std::vector<CompoundType::member_def> members;
+  for (size_t i = 0; i < n_members; i++)
+    members.emplace_back("h" + std::to_string(i), AtomicType<int>(), i * sizeof(int));
+  const CompoundType header_type(members, n_members * sizeof(int));
+
+  std::vector<int> records(n * n_members);
+  for (size_t i = 0; i < records.size(); i++)
+    records[i] = int(i);
+
+  File file("bench_compound_fields.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet("headers", DataSpace(n), header_type);
+  dset.write_raw(records.data(), header_type);
+  file.flush();
+
+  bench::measure("read whole records (" + std::to_string(n) + ")", 1, [&](size_t) {
+    dset.read(records.data(), header_type);
+    bench::doNotOptimize(records[0]);
+  });
+
+  bench::measure("readFields (1 member)", 1, [&](size_t) {
+    auto cdp = std::get<0>(dset.readFields<int>({"h5"}));
+    bench::doNotOptimize(cdp[0]);
+  });
+
+  bench::measure("readFields (4 members)", 1, [&](size_t) {
+    auto columns = dset.readFields<int, int, double, double>({"h0", "h5", "h71", "h72"});
+    bench::doNotOptimize(std::get<0>(columns)[0]);
+  });
+
+  std::vector<int> cdp(n, -1);
+  bench::measure("writeFields (1 member)", 1, [&](size_t) {
+    dset.writeFields({"h5"}, std::make_tuple(cdp));
+  });
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+
+#include "benchmark.hpp"
+
+// Read a table of records with two variable length string columns
+// (well and line names) to std::vector of structs with std::string
+// members and compare with reading the same table without strings
+//
+
+struct Record {
+  int trace;
+  double x;
+  double y;
+  std::string well;
+  std::string line;
+};
+
+struct RecordRaw {
+  int trace;
+  double x;
+  double y;
+  const char* well;
+  const char* line;
+};
+
+struct Point {
+  int trace;
+  double x;
+  double y;
+};
+
+h5gt::CompoundType create_compound_record() {
+  using namespace h5gt;
+  return CompoundType({
+      {"trace", AtomicType<int>{}, offsetof(Record, trace)},
+      {"x", AtomicType<double>{}, offsetof(Record, x)},
+      {"y", AtomicType<double>{}, offsetof(Record, y)},
+      {"well", AtomicType<std::string>{}, offsetof(Record, well)},
+      {"line", AtomicType<std::string>{}, offsetof(Record, line)}
+    }, sizeof(Record));
+}
+
+h5gt::CompoundType create_compound_point() {
+  using namespace h5gt;
+  return CompoundType({
+      {"trace", AtomicType<int>{}, offsetof(Point, trace)},
+      {"x", AtomicType<double>{}, offsetof(Point, x)},
+      {"y", AtomicType<double>{}, offsetof(Point, y)}
+    }, sizeof(Point));
+}
+
+H5GT_REGISTER_TYPE(Record, create_compound_record)
+H5GT_REGISTER_TYPE(Point, create_compound_point)
+
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+  const CompoundType raw_type({
+      {"trace", AtomicType<int>{}, offsetof(RecordRaw, trace)},
+      {"x", AtomicType<double>{}, offsetof(RecordRaw, x)},
+      {"y", AtomicType<double>{}, offsetof(RecordRaw, y)},
+      {"well", AtomicType<std::string>{}, offsetof(RecordRaw, well)},
+      {"line", AtomicType<std::string>{}, offsetof(RecordRaw, line)}
+    }, sizeof(RecordRaw));
+
+  std::vector<std::string> wells(n);
+  std::vector<RecordRaw> raw(n);
+  for (size_t i = 0; i < n; i++) {
+    wells[i] = "WELL_" + std::to_string(i % 1000);
+    raw[i] = {int(i), double(i), double(i), wells[i].c_str(), "INLINE_0001"};
+  }
+
+  File file("bench_compound_vlen.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet("records", DataSpace(n), raw_type);
+  dset.write_raw(reinterpret_cast<const char*>(raw.data()), raw_type);
+  DataSet dset_points = file.createDataSet("points", DataSpace(n), create_compound_point());
+  file.flush();
+
+  std::vector<Point> points(n);
+  dset_points.write(points);
+  bench::measure("read std::vector<Point> (" + std::to_string(n) + ", no strings)", 3, [&](size_t) {
+    dset_points.read(points);
+    bench::doNotOptimize(points[0]);
+  });
+
+  std::vector<Record> records;
+  bench::measure("read std::vector<Record> (2 string members)", 3, [&](size_t) {
+    dset.read(records);
+    bench::doNotOptimize(records[0]);
+  });
+
+  // lower bound: strings are left as `char*` allocated by HDF5
+  bench::measure("read RecordRaw (char*, no conversion)", 3, [&](size_t) {
+    dset.read(reinterpret_cast<char*>(raw.data()), raw_type);
+    bench::doNotOptimize(raw[0]);
+    H5Dvlen_reclaim(raw_type.getId(false), dset.getMemSpace().getId(false),
+                    H5P_DEFAULT, raw.data());
+  });
+
+  return 0;
+}
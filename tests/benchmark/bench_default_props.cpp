@@ -0,0 +1,64 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+#include <h5gt/H5Group.hpp>
+
+#include "benchmark.hpp"
+
+// Metadata-heavy workload: open many small objects.
+// Compares property lists created per call (`H5Pcreate`/`H5Pclose`)
+// with shared default property lists (`XxxProps::Default()`)
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 20000;
+  File file("bench_default_props.h5", File::ReadWrite | File::Create | File::Truncate);
+  Group group = file.createGroup("group");
+  for (size_t i = 0; i < n; i++)
+    group.createDataSet<int>(std::to_string(i), DataSpace(1));
+
+  bench::measure("getDataSet (new props per call)", n, [&](size_t i) {
+    DataSet dset = group.getDataSet(
+          std::to_string(i), DataSetAccessProps());
+    bench::doNotOptimize(dset.getId(false));
+  });
+
+  bench::measure("getDataSet (default props)", n, [&](size_t i) {
+    DataSet dset = group.getDataSet(std::to_string(i));
+    bench::doNotOptimize(dset.getId(false));
+  });
+
+  bench::measure("hasObject (new props per call)", n, [&](size_t i) {
+    bool val = group.hasObject(
+          std::to_string(i), ObjectType::Dataset, LinkAccessProps());
+    bench::doNotOptimize(val);
+  });
+
+  bench::measure("hasObject (default props)", n, [&](size_t i) {
+    bool val = group.hasObject(std::to_string(i), ObjectType::Dataset);
+    bench::doNotOptimize(val);
+  });
+
+  bench::measure("createDataSet (new props per call)", n, [&](size_t i) {
+    DataSet dset = group.createDataSet<int>(
+          "a" + std::to_string(i), DataSpace(1),
+          LinkCreateProps(), DataSetCreateProps(), DataSetAccessProps());
+    bench::doNotOptimize(dset.getId(false));
+  });
+
+  bench::measure("createDataSet (default props)", n, [&](size_t i) {
+    DataSet dset = group.createDataSet<int>(
+          "b" + std::to_string(i), DataSpace(1));
+    bench::doNotOptimize(dset.getId(false));
+  });
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+#include <h5gt/H5Group.hpp>
+
+#include "benchmark.hpp"
+
+using namespace h5gt;
+
+// write `nDsets` small datasets and one big chunked dataset then read them back
+static void scratch_workload(const std::string& name, const FileAccessProps& fapl,
+                             size_t nDsets, const std::vector<float>& big) {
+  File file(name, File::ReadWrite | File::Create | File::Truncate, fapl);
+  std::vector<float> small(64, 1.f);
+  for (size_t i = 0; i < nDsets; i++)
+    file.createDataSet("small_" + std::to_string(i), small).write(small);
+
+  DataSetCreateProps props;
+  props.setChunk({size_t(1) << 18});
+  DataSet dset = file.createDataSet<float>(
+        "big", DataSpace({big.size()}), LinkCreateProps::Default(), props);
+  dset.write(big);
+
+  std::vector<float> result;
+  dset.read(result);
+  for (size_t i = 0; i < nDsets; i++)
+    file.getDataSet("small_" + std::to_string(i)).read(small);
+  bench::doNotOptimize(result);
+}
+
+// metadata heavy file: many groups with attributes
+static void metadata_workload(const std::string& name, const FileAccessProps& fapl,
+                              size_t nGroups, const std::vector<float>& big) {
+  {
+    File file(name, File::ReadWrite | File::Create | File::Truncate, fapl);
+    file.createDataSet("raw", big).write(big);
+    for (size_t i = 0; i < nGroups; i++)
+      file.createGroup("g" + std::to_string(i))
+          .createAttribute<int>("id", DataSpace(1)).write(int(i));
+  }
+
+  File file(name, File::ReadOnly, fapl);
+  int value = 0;
+  for (const std::string& objName : file.listObjectNames())
+    if (objName != "raw")
+      file.getGroup(objName).getAttribute("id").read(value);
+  bench::doNotOptimize(value);
+}
+
+// Compare file drivers on typical workloads
+//
+int main(int argc, char** argv) {
+  const size_t mb = argc > 1 ? std::stoul(argv[1]) : 64;
+  std::vector<float> big((mb << 20) / sizeof(float));
+  for (size_t i = 0; i < big.size(); i++)
+    big[i] = float(i % 1000);
+
+  std::cout << "-- scratch file (" << mb << " MiB + 2000 small datasets)" << std::endl;
+  bench::measure("sec2", 1, [&](size_t) {
+    scratch_workload("bench_drivers_sec2.h5", FileAccessProps::Default(), 2000, big);
+  });
+  bench::measure("core (no backing store)", 1, [&](size_t) {
+    scratch_workload("bench_drivers_core.h5", CoreFileDriver(size_t(64) << 20), 2000, big);
+  });
+  bench::measure("family (16 MiB members)", 1, [&](size_t) {
+    scratch_workload("bench_drivers_family_%d.h5", FamilyFileDriver(hsize_t(16) << 20), 2000, big);
+  });
+  bench::measure("sec2 aligned to 1 MiB", 1, [&](size_t) {
+    scratch_workload("bench_drivers_aligned.h5", Sec2FileDriver(1 << 16, 1 << 20), 2000, big);
+  });
+#ifdef H5_HAVE_DIRECT
+  bench::measure("direct", 1, [&](size_t) {
+    scratch_workload("bench_drivers_direct.h5", DirectFileDriver(), 2000, big);
+  });
+#endif
+
+  std::cout << "-- metadata heavy file (" << mb << " MiB + 5000 groups)" << std::endl;
+  bench::measure("sec2", 1, [&](size_t) {
+    metadata_workload("bench_drivers_meta.h5", FileAccessProps::Default(), 5000, big);
+  });
+  bench::measure("split", 1, [&](size_t) {
+    metadata_workload("bench_drivers_split", SplitFileDriver(), 5000, big);
+  });
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+#include <h5gt/H5Filter.hpp>
+
+#include "benchmark.hpp"
+
+using namespace h5gt;
+
+// the loop used before vectorization
+static void shuffle_scalar(const char* src, char* dst, size_t nbytes, size_t elemSize) {
+  const size_t n = nbytes / elemSize;
+  for (size_t j = 0; j < elemSize; j++)
+    for (size_t i = 0; i < n; i++)
+      dst[j * n + i] = src[i * elemSize + j];
+}
+
+static void unshuffle_scalar(const char* src, char* dst, size_t nbytes, size_t elemSize) {
+  const size_t n = nbytes / elemSize;
+  for (size_t j = 0; j < elemSize; j++)
+    for (size_t i = 0; i < n; i++)
+      dst[i * elemSize + j] = src[j * n + i];
+}
+
+// write and read back `data` with the given pipeline, print compression ratio
+static void pipeline(const std::string& name, const std::vector<float>& data,
+                     const std::vector<size_t>& dims,
+                     const std::function<void(DataSetCreateProps&)>& setFilters) {
+  File file("bench_filters.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSetCreateProps props;
+  props.setChunk({64, dims[1]});
+  setFilters(props);
+  DataSet dset = file.createDataSet<float>(
+        "data", DataSpace(dims), LinkCreateProps::Default(), props);
+
+  std::vector<float> result(data.size());
+  bench::measure(name + " write", 1, [&](size_t) {
+    dset.write_raw(data.data());
+  });
+  bench::measure(name + " read", 1, [&](size_t) {
+    dset.read(result.data());
+  });
+  bench::doNotOptimize(result);
+  std::cout << "  ratio: " << std::setprecision(2)
+            << double(data.size() * sizeof(float)) / dset.getStorageSize()
+            << std::endl;
+}
+
+// Compare filter pipelines on seismic-like float amplitudes
+//
+int main(int argc, char** argv) {
+  const size_t nTraces = argc > 1 ? std::stoul(argv[1]) : 1024;
+  const size_t nSamples = 2000;
+  const std::vector<size_t> dims{nTraces, nSamples};
+
+  // decaying wavelets with noise
+  std::mt19937 gen(1);
+  std::normal_distribution<float> noise(0.f, 0.01f);
+  std::vector<float> data(nTraces * nSamples);
+  for (size_t i = 0; i < nTraces; i++)
+    for (size_t j = 0; j < nSamples; j++)
+      data[i * nSamples + j] = std::exp(-float(j) * 0.002f) *
+          std::sin(float(j) * 0.05f + float(i) * 0.01f) + noise(gen);
+
+  const size_t nbytes = data.size() * sizeof(float);
+  const char* src = reinterpret_cast<const char*>(data.data());
+  std::vector<char> dst(nbytes), back(nbytes);
+
+  std::cout << "-- codecs on " << (nbytes >> 20) << " MiB" << std::endl;
+  bench::measure("byte shuffle (scalar loop)", 10, [&](size_t) {
+    shuffle_scalar(src, dst.data(), nbytes, sizeof(float));
+  });
+  bench::measure("byte shuffle", 10, [&](size_t) {
+    ByteShuffleFilter::encode(src, dst.data(), nbytes, sizeof(float));
+  });
+  bench::measure("byte unshuffle (scalar loop)", 10, [&](size_t) {
+    unshuffle_scalar(dst.data(), back.data(), nbytes, sizeof(float));
+  });
+  bench::measure("byte unshuffle", 10, [&](size_t) {
+    ByteShuffleFilter::decode(dst.data(), back.data(), nbytes, sizeof(float));
+  });
+  bench::measure("bit shuffle", 10, [&](size_t) {
+    BitShuffleFilter::encode(src, dst.data(), nbytes, sizeof(float));
+  });
+  bench::measure("bit unshuffle", 10, [&](size_t) {
+    BitShuffleFilter::decode(dst.data(), back.data(), nbytes, sizeof(float));
+  });
+  bench::measure("delta encode", 10, [&](size_t) {
+    DeltaFilter::encode(src, dst.data(), nbytes, sizeof(float));
+  });
+  bench::measure("delta decode", 10, [&](size_t) {
+    DeltaFilter::decode(dst.data(), back.data(), nbytes, sizeof(float));
+  });
+  bench::doNotOptimize(back);
+
+  registerFilter<BitShuffleFilter>();
+  registerFilter<DeltaFilter>();
+
+  std::cout << "-- pipelines" << std::endl;
+  pipeline("no filters", data, dims, [](DataSetCreateProps&) {});
+  pipeline("deflate(4)", data, dims, [](DataSetCreateProps& props) {
+    props.setDeflate(4);
+  });
+  pipeline("shuffle + deflate(4)", data, dims, [](DataSetCreateProps& props) {
+    props.setShuffle();
+    props.setDeflate(4);
+  });
+  pipeline("bit shuffle + deflate(1)", data, dims, [](DataSetCreateProps& props) {
+    props.setFilter(BitShuffleFilter::id);
+    props.setDeflate(1);
+  });
+  pipeline("bit shuffle + deflate(4)", data, dims, [](DataSetCreateProps& props) {
+    props.setFilter(BitShuffleFilter::id);
+    props.setDeflate(4);
+  });
+  pipeline("scale-offset(3 digits) + deflate(4)", data, dims, [](DataSetCreateProps& props) {
+    props.setScaleOffset(H5Z_SO_FLOAT_DSCALE, 3);
+    props.setDeflate(4);
+  });
+  pipeline("fletcher32", data, dims, [](DataSetCreateProps& props) {
+    props.setFletcher32();
+  });
+
+  return 0;
+}
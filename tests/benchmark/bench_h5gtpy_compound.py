@@ -0,0 +1,53 @@
+#  Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Read a compound (trace header) table to NumPy structured array in one
+# call and compare with reading it column by column.
+#
+#   python bench_h5gtpy_compound.py [number of records, default 1000000]
+
+import sys
+import time
+
+import numpy as np
+from h5gtpy import h5gt
+
+
+def measure(name, n, func):
+    start = time.perf_counter()
+    for i in range(n):
+        func()
+    ns = (time.perf_counter() - start) * 1e9 / n
+    print(f'{name:<48}{ns:>12.1f} ns/call')
+    return ns
+
+
+def main():
+    n_records = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+    dt = np.dtype([('trace', 'i4'), ('cdp', 'i4'), ('offset', 'f4'),
+                   ('x', 'f8'), ('y', 'f8'), ('elev', 'f4'), ('name', 'S8')], align=True)
+    arr = np.zeros(n_records, dtype=dt)
+    for name in dt.names[:-1]:
+        arr[name] = np.random.rand(n_records) * 1000
+
+    file = h5gt.File('bench_h5gtpy_compound.h5',
+                     h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+    dset = file.createDataSet('headers', n_records, h5gt.CompoundType.fromNumpy(dt))
+
+    print(f'-- {n_records} records of {dt.itemsize} bytes')
+    measure('write (structured array)', 1, lambda: dset.write(arr))
+    measure('read (structured array)', 1, lambda: dset.read())
+
+    out = np.empty_like(arr)
+    measure('read(out=)', 1, lambda: dset.read(out=out))
+    assert np.array_equal(out, arr)
+
+    def by_column():
+        for name in dt.names:
+            dset.read(out=np.empty(n_records, dtype=[(name, dt.fields[name][0])]))
+    measure('read column by column', 1, by_column)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,50 @@
+#  Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Compare NumPy-style indexing (`dset[key]`) with selections built
+# by hand and read with `readX` (transposed Eigen copy).
+#
+#   python bench_h5gtpy_getitem.py [number of calls, default 1000]
+
+import sys
+import time
+
+import numpy as np
+from h5gtpy import h5gt
+
+
+def measure(name, n, func):
+    start = time.perf_counter()
+    for i in range(n):
+        func()
+    ns = (time.perf_counter() - start) * 1e9 / n
+    print(f'{name:<48}{ns:>12.1f} ns/call')
+    return ns
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    n_traces, n_samples = 10000, 1000
+    m = np.random.rand(n_traces, n_samples)
+
+    file = h5gt.File('bench_h5gtpy_getitem.h5',
+                     h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+    dset = file.createDataSet('data', list(m.shape), h5gt.AtomicDouble())
+    dset.write_raw(m)
+    file.flush()
+
+    rows = np.random.choice(n_traces, 100, replace=False)
+    print(f'-- {n_traces}x{n_samples} float64 dataset, {n} calls')
+    measure('select + readDouble (strided block)', n,
+            lambda: dset.select([100, 0], [50, 100], [2, 10]).readDouble())
+    measure('dset[100:200:2, ::10]', n, lambda: dset[100:200:2, ::10])
+    measure('select_rows + readDouble (100 rows)', n,
+            lambda: dset.select_rows(sorted(rows.tolist())).readDouble())
+    measure('dset[rows] (100 unordered rows)', n, lambda: dset[rows])
+    measure('dset[rows, ::-1] (reversed samples)', n, lambda: dset[rows, ::-1])
+    measure('dset[5, 7] (single element)', n, lambda: dset[5, 7])
+
+
+if __name__ == '__main__':
+    main()
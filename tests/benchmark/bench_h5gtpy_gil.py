@@ -0,0 +1,77 @@
+#  Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Read a dataset in a background thread while the main thread runs
+# pure Python compute. With thread-safe HDF5 (H5_HAVE_THREADSAFE)
+# h5gtpy releases the GIL during I/O so the overlapped time should
+# approach max(read, compute) instead of their sum. Otherwise the GIL
+# is kept and the times simply add up.
+#
+#   python bench_h5gtpy_gil.py [size in MiB, default 1024]
+
+import sys
+import threading
+import time
+
+import numpy as np
+from h5gtpy import h5gt
+
+
+def measure(name, func):
+    start = time.perf_counter()
+    func()
+    ns = (time.perf_counter() - start) * 1e9
+    print(f'{name:<48}{ns:>16.1f} ns')
+    return ns
+
+
+def compute(n):
+    s = 0
+    for i in range(n):
+        s += i * i
+    return s
+
+
+def main():
+    size_mib = int(sys.argv[1]) if len(sys.argv) > 1 else 1024
+    n_samples = 2000
+    n_traces = size_mib * (1 << 20) // (n_samples * 8)
+    m = np.random.rand(n_traces, n_samples)
+
+    file = h5gt.File('bench_h5gtpy_gil.h5',
+                     h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+    dset = file.createDataSet('data', list(m.shape), h5gt.AtomicDouble())
+    dset.write_raw(m)
+    file.flush()
+    out = np.empty_like(m)
+
+    # calibrate compute to take about as long as the read
+    t_read = measure('read', lambda: dset.read(out=out))
+    n = 1 << 20
+    t_compute = measure(f'compute ({n} iterations)', lambda: compute(n))
+    n = max(1, int(n * t_read / t_compute))
+
+    print(f'-- {m.nbytes >> 20} MiB, compute of {n} iterations')
+    measure('read then compute', lambda: (dset.read(out=out), compute(n)))
+
+    def overlapped():
+        reader = threading.Thread(target=lambda: dset.read(out=out))
+        reader.start()
+        compute(n)
+        reader.join()
+    measure('read in thread overlapped with compute', overlapped)
+
+    def two_readers():
+        sel = [dset.select([0, 0], [n_traces // 2, n_samples]),
+               dset.select([n_traces // 2, 0], [n_traces - n_traces // 2, n_samples])]
+        threads = [threading.Thread(target=s.read) for s in sel]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    measure('two reader threads (serialized by HDF5)', two_readers)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,48 @@
+#  Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Compare NumPy read/write through Eigen matrices (`write`, `readDouble`)
+# with direct buffer access (`write_raw`, `read`).
+#
+#   python bench_h5gtpy_numpy_io.py [size in MiB, default 1024]
+
+import sys
+import time
+
+import numpy as np
+from h5gtpy import h5gt
+
+
+def measure(name, n, func):
+    start = time.perf_counter()
+    for i in range(n):
+        func()
+    ns = (time.perf_counter() - start) * 1e9 / n
+    print(f'{name:<48}{ns:>12.1f} ns/call')
+    return ns
+
+
+def main():
+    size_mib = int(sys.argv[1]) if len(sys.argv) > 1 else 1024
+    n_samples = 2000
+    n_traces = size_mib * (1 << 20) // (n_samples * 8)
+    m = np.random.rand(n_traces, n_samples)
+
+    file = h5gt.File('bench_h5gtpy_numpy_io.h5',
+                     h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+    dset = file.createDataSet('data', list(m.shape), h5gt.AtomicDouble())
+
+    print(f'-- {m.nbytes >> 20} MiB of float64')
+    measure('write (Eigen copy)', 1, lambda: dset.write(m))
+    measure('write_raw (zero-copy)', 1, lambda: dset.write_raw(m))
+
+    measure('readDouble (Eigen copy)', 1, lambda: dset.readDouble())
+    measure('read', 1, lambda: dset.read())
+    out = np.empty_like(m)
+    measure('read(out=)', 1, lambda: dset.read(out=out))
+    assert np.array_equal(m, out)
+
+
+if __name__ == '__main__':
+    main()
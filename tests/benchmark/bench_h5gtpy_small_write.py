@@ -0,0 +1,53 @@
+#  Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Per-call overhead of small reads and writes where argument dispatch
+# rather than I/O dominates.
+#
+#   python bench_h5gtpy_small_write.py [number of calls, default 100000]
+
+import sys
+import time
+
+import numpy as np
+from h5gtpy import h5gt
+
+
+def measure(name, n, func):
+    start = time.perf_counter()
+    for i in range(n):
+        func()
+    ns = (time.perf_counter() - start) * 1e9 / n
+    print(f'{name:<48}{ns:>12.1f} ns/call')
+    return ns
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+    file = h5gt.File('bench_h5gtpy_small_write.h5',
+                     h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+    dset = file.createDataSet('data', [4, 4], h5gt.AtomicFloat())
+    scalar = file.createDataSet('scalar', 1, h5gt.AtomicFloat())
+
+    m32 = np.random.rand(4, 4).astype(np.float32)
+    m64 = m32.astype(np.float64)
+    v = np.random.rand(4).astype(np.float32)
+    row = dset.select([0, 0], [1, 4])
+    out = np.empty_like(m32)
+
+    print(f'-- 4x4 float dataset, {n} calls')
+    measure('write(float32 array)', n, lambda: dset.write(m32))
+    measure('write(float64 array)', n, lambda: dset.write(m64))
+    measure('write(float)', n, lambda: scalar.write(1.5))
+    measure('write(list)', n, lambda: row.write([0.0, 1.0, 2.0, 3.0]))
+    measure('selection write(float32 array)', n, lambda: row.write(v))
+    measure('write_raw(float32 array)', n, lambda: dset.write_raw(m32))
+    measure('readFloat', n, lambda: dset.readFloat())
+    measure('read', n, lambda: dset.read())
+    measure('read(out=)', n, lambda: dset.read(out=out))
+
+
+if __name__ == '__main__':
+    main()
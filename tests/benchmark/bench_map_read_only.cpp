@@ -0,0 +1,64 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <random>
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include "benchmark.hpp"
+
+// Random access to a contiguous 2D dataset through single element
+// selections (H5Dread) and through memory mapped view
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 2048;
+  const std::vector<size_t> dims{n, n};
+  const std::string file_name("bench_map_read_only.h5");
+  {
+    std::vector<float> data(n * n);
+    for (size_t i = 0; i < data.size(); i++)
+      data[i] = float(i);
+    File file(file_name, File::ReadWrite | File::Create | File::Truncate);
+    file.createDataSet<float>("data", DataSpace(dims)).write_raw(data.data());
+  }
+
+  File file(file_name, File::ReadOnly);
+  DataSet dset = file.getDataSet("data");
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<size_t> dist(0, n - 1);
+  const size_t nsamples = 10000;
+  std::vector<size_t> rows(nsamples), cols(nsamples);
+  for (size_t i = 0; i < nsamples; i++) {
+    rows[i] = dist(gen);
+    cols[i] = dist(gen);
+  }
+
+  float value;
+  bench::measure("select(i, j).read", nsamples, [&](size_t i) {
+    dset.select({rows[i], cols[i]}, {1, 1}).read(&value);
+    bench::doNotOptimize(value);
+  });
+
+  bench::measure("mapReadOnly", 1, [&](size_t) {
+    DataSetView<float> view = dset.mapReadOnly<float>();
+    bench::doNotOptimize(view.data());
+  });
+
+  DataSetView<float> view = dset.mapReadOnly<float>();
+  std::cout << "view is " << (view.isMapped() ? "" : "not ") << "mapped" << std::endl;
+  bench::measure("view(i, j)", nsamples, [&](size_t i) {
+    value = view(rows[i], cols[i]);
+    bench::doNotOptimize(value);
+  });
+
+  return 0;
+}
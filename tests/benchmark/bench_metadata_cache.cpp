@@ -0,0 +1,88 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5Group.hpp>
+#include <h5gt/H5Attribute.hpp>
+
+#include "benchmark.hpp"
+
+using namespace h5gt;
+
+// `nOuter` groups each containing `nInner` groups with an attribute
+static void create_hierarchy(const std::string& name, const FileAccessProps& fapl,
+                             size_t nOuter, size_t nInner) {
+  File file(name, File::ReadWrite | File::Create | File::Truncate, fapl);
+  for (size_t i = 0; i < nOuter; i++) {
+    Group outer = file.createGroup("g" + std::to_string(i));
+    for (size_t j = 0; j < nInner; j++)
+      outer.createGroup("g" + std::to_string(j))
+          .createAttribute<int>("id", DataSpace(1)).write(int(i * nInner + j));
+  }
+}
+
+// open the file and visit every group
+static double traverse(const std::string& name, unsigned openFlags,
+                       const FileAccessProps& fapl) {
+  File file(name, openFlags, fapl);
+  int value = 0;
+  for (const std::string& outerName : file.listObjectNames()) {
+    Group outer = file.getGroup(outerName);
+    for (const std::string& innerName : outer.listObjectNames())
+      outer.getGroup(innerName).getAttribute("id").read(value);
+  }
+  bench::doNotOptimize(value);
+  return file.getMdcHitRate();
+}
+
+// Compare opening a large hierarchy with cold metadata cache,
+// bigger cache and cache image.
+// Cache image replaces many small metadata reads with a single big one:
+// it pays off on high latency storage (network/parallel file systems)
+// rather than on local disk with warm page cache
+//
+int main(int argc, char** argv) {
+  const size_t nOuter = argc > 1 ? std::stoul(argv[1]) : 100;
+  const size_t nInner = 200;
+  const size_t n = 5;
+  double hitRate = 0;
+
+  // cache image requires the latest file format
+  FileAccessProps latest;
+  latest.setLibverBounds(H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+
+  FileAccessProps bigCache;
+  bigCache.setLibverBounds(H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+  bigCache.setMdcSize(size_t(64) << 20, size_t(16) << 20, size_t(128) << 20);
+
+  FileAccessProps withImage;
+  withImage.setLibverBounds(H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+  withImage.setMdcImageConfig(true);
+
+  std::cout << "-- open and visit " << nOuter * nInner << " groups" << std::endl;
+
+  create_hierarchy("bench_mdc.h5", latest, nOuter, nInner);
+  bench::measure("cold cache", n, [&](size_t) {
+    hitRate = traverse("bench_mdc.h5", File::ReadOnly, latest);
+  });
+  std::cout << "  hit rate: " << hitRate << std::endl;
+
+  bench::measure("cold 64 MiB cache", n, [&](size_t) {
+    hitRate = traverse("bench_mdc.h5", File::ReadOnly, bigCache);
+  });
+  std::cout << "  hit rate: " << hitRate << std::endl;
+
+  // read-only open loads the image and keeps it in the file
+  create_hierarchy("bench_mdc_image.h5", withImage, nOuter, nInner);
+  bench::measure("64 MiB cache warm-started from cache image", n, [&](size_t) {
+    hitRate = traverse("bench_mdc_image.h5", File::ReadOnly, bigCache);
+  });
+  std::cout << "  hit rate: " << hitRate << std::endl;
+
+  return 0;
+}
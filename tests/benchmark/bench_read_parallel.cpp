@@ -0,0 +1,71 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include "benchmark.hpp"
+
+// Read a compressed (shuffle + deflate) 3D cube through HDF5 filter
+// pipeline (H5Dread) and with multi-threaded chunk decoding
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 256;
+  const std::vector<size_t> dims{n, n, n};
+  std::vector<float> data(n * n * n);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = std::sin(float(i) * 0.001f) * 1000.f;
+
+  DataSetCreateProps props;
+  props.setChunk({64, 64, 64});
+  props.setShuffle();
+  props.setDeflate(6);
+
+  File file("bench_read_parallel.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet<float>(
+        "data", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset.writeParallel(data.data(), {0, 0, 0}, dims);
+
+  const double mb = double(data.size() * sizeof(float)) / (1024 * 1024);
+  std::vector<float> result(data.size());
+
+  double ns = bench::measure("read (H5Dread)", 1, [&](size_t) {
+    dset.read(result.data());
+  });
+  std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+  bench::doNotOptimize(result);
+
+  const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  for (size_t t = 1; t <= max_threads; t *= 2) {
+    ns = bench::measure("readParallel (" + std::to_string(t) + " threads)", 1, [&](size_t) {
+      dset.readParallel(result.data(), t);
+    });
+    std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+    bench::doNotOptimize(result);
+  }
+
+  // box that isn't chunk aligned
+  Selection sel = dset.select({10, 10, 10}, {n - 20, n - 20, n - 20});
+  ns = bench::measure("read unaligned box (H5Dread)", 1, [&](size_t) {
+    sel.read(result.data());
+  });
+  std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+
+  ns = bench::measure("readParallel unaligned box (" + std::to_string(max_threads) + " threads)", 1, [&](size_t) {
+    sel.readParallel(result.data(), max_threads);
+  });
+  std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+  bench::doNotOptimize(result);
+
+  return 0;
+}
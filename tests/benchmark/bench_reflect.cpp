@@ -0,0 +1,82 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+
+#include "benchmark.hpp"
+
+// Write and read trace header like records described with H5GT_REFLECT:
+// struct with padding stored packed (HDF5 converts every record) and
+// struct without padding (file and memory datatypes are the same)
+//
+
+struct Header {
+  int trace;
+  double x;
+  double y;
+  int cdp;
+  double offset;
+};
+
+struct HeaderPacked {
+  double x;
+  double y;
+  double offset;
+  int trace;
+  int cdp;
+};
+
+H5GT_REFLECT(Header, trace, x, y, cdp, offset)
+H5GT_REFLECT_PACKED(HeaderPacked, x, y, offset, trace, cdp)
+
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+  bench::measure("create_datatype<Header>()", 10000, [&](size_t) {
+    bench::doNotOptimize(create_datatype<Header>());
+  });
+  bench::measure("create_and_check_datatype<Header>()", 10000, [&](size_t) {
+    bench::doNotOptimize(create_and_check_datatype<Header>());
+  });
+
+  std::vector<Header> headers(n);
+  std::vector<HeaderPacked> headers_packed(n);
+  for (size_t i = 0; i < n; i++) {
+    headers[i] = {int(i), double(i), double(i), int(i / 10), 25.0};
+    headers_packed[i] = {double(i), double(i), 25.0, int(i), int(i / 10)};
+  }
+
+  File file("bench_reflect.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet(
+        "headers", DataSpace(n), create_packed_datatype<Header>());
+  DataSet dset_packed = file.createDataSet(
+        "headers_packed", DataSpace(n), create_packed_datatype<HeaderPacked>());
+
+  const std::string suffix = " (" + std::to_string(n) + ")";
+  bench::measure("write Header (padded, converted)" + suffix, 3, [&](size_t) {
+    dset.write(headers);
+  });
+  bench::measure("write HeaderPacked (no conversion)" + suffix, 3, [&](size_t) {
+    dset_packed.write(headers_packed);
+  });
+  file.flush();
+
+  bench::measure("read Header (padded, converted)" + suffix, 3, [&](size_t) {
+    dset.read(headers);
+    bench::doNotOptimize(headers[0]);
+  });
+  bench::measure("read HeaderPacked (no conversion)" + suffix, 3, [&](size_t) {
+    dset_packed.read(headers_packed);
+    bench::doNotOptimize(headers_packed[0]);
+  });
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include "benchmark.hpp"
+
+// Select and read many trace rows of a 2D dataset
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t nrows = argc > 1 ? std::stoul(argv[1]) : 200000;
+  const size_t ncols = 16;
+  File file("bench_select_rows.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet<float>("data", DataSpace({nrows, ncols}));
+  std::vector<float> data(nrows * ncols, 1);
+  dset.write_raw(data.data());
+
+  std::vector<size_t> every_other(nrows / 2);
+  for (size_t i = 0; i < every_other.size(); i++)
+    every_other[i] = 2 * i;
+
+  std::vector<size_t> shuffled(every_other);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(0));
+
+  std::vector<size_t> random(nrows / 2);
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<size_t> dist(0, nrows - 1);
+  std::generate(random.begin(), random.end(), [&](){ return dist(gen); });
+
+  for (auto& p : {std::make_pair("strided", &every_other),
+                  std::make_pair("strided shuffled", &shuffled),
+                  std::make_pair("random", &random)}) {
+    const std::vector<size_t>& rows = *p.second;
+    std::vector<float> out(rows.size() * ncols);
+    bench::measure(std::string("select_rows (") + p.first + ")", 1, [&](size_t) {
+      Selection sel = dset.select_rows(rows);
+      bench::doNotOptimize(sel.getSpace().getId(false));
+    });
+    bench::measure(std::string("select_rows + read (") + p.first + ")", 1, [&](size_t) {
+      dset.select_rows(rows).read(out.data());
+    });
+  }
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <string>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+
+#include "benchmark.hpp"
+
+// Read variable length strings (well names, trace labels) to
+// std::vector<std::string> and to StringTable
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+  std::vector<std::string> strings(n);
+  for (size_t i = 0; i < n; i++)
+    strings[i] = "WELL_" + std::to_string(i);
+
+  File file("bench_string_table.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet<std::string>("names", DataSpace::From(strings));
+  dset.write(strings);
+  file.flush();
+
+  std::vector<std::string> result;
+  bench::measure("read std::vector<std::string> (" + std::to_string(n) + ")", 3, [&](size_t) {
+    dset.read(result);
+    bench::doNotOptimize(result[0]);
+  });
+
+  bench::measure("read StringTable (first read)", 1, [&](size_t) {
+    StringTable table;
+    dset.read(table);
+    bench::doNotOptimize(table[0]);
+  });
+
+  StringTable table;
+  dset.read(table);
+  bench::measure("read StringTable (arena reused)", 3, [&](size_t) {
+    dset.read(table);
+    bench::doNotOptimize(table[0]);
+  });
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include "benchmark.hpp"
+
+// Write a compressed (shuffle + deflate) 3D cube through HDF5 filter
+// pipeline and with multi-threaded direct chunk write
+//
+int main(int argc, char** argv) {
+  using namespace h5gt;
+
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 256;
+  const std::vector<size_t> dims{n, n, n};
+  std::vector<float> data(n * n * n);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = std::sin(float(i) * 0.001f) * 1000.f;
+
+  DataSetCreateProps props;
+  props.setChunk({64, 64, 64});
+  props.setShuffle();
+  props.setDeflate(6);
+
+  File file("bench_write_parallel.h5", File::ReadWrite | File::Create | File::Truncate);
+  const double mb = double(data.size() * sizeof(float)) / (1024 * 1024);
+
+  double ns = bench::measure("write_raw (HDF5 filter pipeline)", 1, [&](size_t) {
+    DataSet dset = file.createDataSet<float>(
+          "ref", DataSpace(dims), LinkCreateProps::Default(), props);
+    dset.write_raw(data.data());
+  });
+  std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+
+  const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  for (size_t t = 1; t <= max_threads; t *= 2) {
+    ns = bench::measure("writeParallel (" + std::to_string(t) + " threads)", 1, [&](size_t) {
+      DataSet dset = file.createDataSet<float>(
+            "parallel_" + std::to_string(t), DataSpace(dims),
+            LinkCreateProps::Default(), props);
+      dset.writeParallel(data.data(), {0, 0, 0}, dims, t);
+    });
+    std::cout << "  " << mb / (ns * 1e-9) << " MiB/s" << std::endl;
+  }
+
+  return 0;
+}
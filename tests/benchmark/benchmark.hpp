@@ -0,0 +1,41 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5GT_BENCHMARK_HPP
+#define H5GT_BENCHMARK_HPP
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+
+/// \brief run `func` `n` times and print the time per call.
+/// \return time per call in nanoseconds
+template <typename Func>
+inline double measure(const std::string& name, size_t n, Func&& func) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n; i++)
+    func(i);
+  auto stop = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count() / n;
+  std::cout << std::left << std::setw(48) << name
+            << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+            << ns << " ns/call" << std::endl;
+  return ns;
+}
+
+/// \brief prevent the compiler from optimizing away the value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace bench
+
+#endif // H5GT_BENCHMARK_HPP
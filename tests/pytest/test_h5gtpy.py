@@ -10,6 +10,7 @@ from enum import Flag, auto     # allow bitwise operations on enum
 import os.path
 import unittest
 import pathlib
+import threading
 
 trig = False
 
@@ -213,6 +214,319 @@ class test_h5gtpy(unittest.TestCase):
         ss = attr.readStr()
         self.assertListEqual(s, ss)
 
+    def test_transfer_props(self):
+        file_name = 'tmp/test_transfer_props.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+
+        xferProps = h5gt.DataTransferProps()
+        xferProps.setBufferSize(4*1024*1024)
+        self.assertEqual(xferProps.getBufferSize(), 4*1024*1024)
+        xferProps.setHyperVectorSize(2048)
+        self.assertEqual(xferProps.getHyperVectorSize(), 2048)
+        xferProps.setEDCCheck(False)
+        self.assertFalse(xferProps.getEDCCheck())
+        xferProps.setDataTransform('2*x')
+        self.assertEqual(xferProps.getDataTransform(), '2*x')
+
+        v = np.array([0.0, 1.1, 2.2], dtype=np.float64)
+        dset = file.createDataSet('data_double_transform', v.size, h5gt.AtomicDouble())
+        dset.write(v, xferProps)
+        vv = dset.readDouble()
+        self.assertListEqual((2*v).tolist(), vv.flatten().tolist())
+
+        readProps = h5gt.DataTransferProps()
+        readProps.setDataTransform('x/2')
+        vv = dset.readDouble(xferProps=readProps)
+        self.assertListEqual(v.tolist(), vv.flatten().tolist())
+
+    def test_file_tuning_props(self):
+        file_name = 'tmp/test_file_tuning_props.h5'
+
+        fcpl = h5gt.FileCreateProps()
+        fcpl.setFileSpaceStrategy(h5gt.FileSpaceStrategy.PAGE, True, 16)
+        fcpl.setFileSpacePageSize(8192)
+        self.assertEqual(fcpl.getFileSpaceStrategy(), (h5gt.FileSpaceStrategy.PAGE, True, 16))
+        self.assertEqual(fcpl.getFileSpacePageSize(), 8192)
+
+        fapl = h5gt.FileAccessProps()
+        fapl.setPageBufferSize(8*8192, 25, 50)
+        self.assertEqual(fapl.getPageBufferSize(), (8*8192, 25, 50))
+        fapl.setAlignment(4096, 8192)
+        self.assertEqual(fapl.getAlignment(), (4096, 8192))
+        fapl.setMetaBlockSize(8192)
+        self.assertEqual(fapl.getMetaBlockSize(), 8192)
+        fapl.setSmallDataBlockSize(8192)
+        self.assertEqual(fapl.getSmallDataBlockSize(), 8192)
+        fapl.setSieveBufSize(1024*1024)
+        self.assertEqual(fapl.getSieveBufSize(), 1024*1024)
+        fapl.setLibverBounds(h5gt.LibVersion.V110, h5gt.LibVersion.LATEST)
+        self.assertEqual(fapl.getLibverBounds(), (h5gt.LibVersion.V110, h5gt.LibVersion.LATEST))
+
+        v = np.arange(1000, dtype=np.int32)
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate),
+                         h5gt.FileAccessProps.Default(), fcpl)
+        dset = file.createDataSet('data', v.size, h5gt.AtomicInt())
+        dset.write(v)
+        del dset
+        del file
+
+        # page buffer may only be used with paged files
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadOnly), fapl)
+        vv = file.getDataSet('data').readInt()
+        self.assertListEqual(v.tolist(), vv.flatten().tolist())
+
+    def test_metadata_cache(self):
+        file_name = 'tmp/test_metadata_cache.h5'
+
+        fapl = h5gt.FileAccessProps()
+        fapl.setMdcSize(4*1024*1024, 1024*1024, 64*1024*1024)
+        self.assertEqual(fapl.getMdcSize(), (4*1024*1024, 1024*1024, 64*1024*1024))
+        fapl.setMdcAutoResize(False)
+        self.assertFalse(fapl.getMdcAutoResize())
+        fapl.setMdcImageConfig(True)
+        self.assertEqual(fapl.getMdcImageConfig(), (True, False, -1))
+        fapl.setLibverBounds(h5gt.LibVersion.LATEST, h5gt.LibVersion.LATEST)
+        fapl.setEvictOnClose(True)
+        self.assertTrue(fapl.getEvictOnClose())
+        fapl.setEvictOnClose(False)
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate), fapl)
+        for i in range(100):
+            file.createGroup('g' + str(i))
+        maxSize, minCleanSize, curSize, curNumEntries = file.getMdcSize()
+        self.assertEqual(maxSize, 4*1024*1024)
+        self.assertGreater(curSize, 0)
+        self.assertGreater(curNumEntries, 0)
+        del file
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadOnly))
+        file.resetMdcHitRateStats()
+        for i in range(100):
+            file.getGroup('g' + str(i))
+        self.assertGreater(file.getMdcHitRate(), 0)
+
+    def test_filters(self):
+        file_name = 'tmp/test_filters.h5'
+
+        h5gt.registerBitShuffleFilter()
+        self.assertTrue(h5gt.isFilterAvailable(h5gt.BIT_SHUFFLE_FILTER))
+
+        props = h5gt.DataSetCreateProps()
+        props.setChunk([16, 100])
+        props.setFilter(h5gt.BIT_SHUFFLE_FILTER)
+        props.setDeflate(4)
+        props.setFletcher32()
+        self.assertEqual(props.getFilterCount(), 3)
+        self.assertEqual([f.getId() for f in props.getFilters()],
+                         [h5gt.BIT_SHUFFLE_FILTER, 1, 3])
+        self.assertTrue(props.hasFilter(h5gt.BIT_SHUFFLE_FILTER))
+        props.removeFilter(3)
+        self.assertFalse(props.hasFilter(3))
+        props.setAllocTime(h5gt.AllocTime.EARLY)
+        self.assertEqual(props.getAllocTime(), h5gt.AllocTime.EARLY)
+        props.setFillTime(h5gt.FillTime.NEVER)
+        self.assertEqual(props.getFillTime(), h5gt.FillTime.NEVER)
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        m = np.random.rand(64, 100).astype(np.float32)
+        dset = file.createDataSet('data', list(m.shape), h5gt.AtomicFloat(),
+                                  h5gt.LinkCreateProps.Default(), props)
+        dset.write(m)
+        mm = dset.read()
+        self.assertListEqual(m.tolist(), mm.tolist())
+        self.assertTrue(dset.getCreateProps().hasFilter(h5gt.BIT_SHUFFLE_FILTER))
+
+    def test_numpy_read_write(self):
+        file_name = 'tmp/test_numpy_read_write.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        m = np.arange(4*5*6, dtype=np.float64).reshape(4, 5, 6)
+        dset = file.createDataSet('data', list(m.shape), h5gt.AtomicDouble())
+        dset.write_raw(m)
+
+        mm = dset.read()
+        self.assertEqual(mm.shape, m.shape)
+        self.assertEqual(mm.dtype, np.float64)
+        self.assertTrue(mm.flags['C_CONTIGUOUS'])
+        self.assertTrue(np.array_equal(m, mm))
+
+        # non contiguous array is copied to C order before writing
+        dset.write_raw(np.ascontiguousarray(m[::-1])[::-1])
+        self.assertTrue(np.array_equal(m, dset.read()))
+
+        # `out` array of other dtype is filled with HDF5 conversion
+        out = np.empty(m.shape, dtype=np.float32)
+        self.assertIs(dset.read(out=out), out)
+        self.assertTrue(np.array_equal(m.astype(np.float32), out))
+
+        sel = dset.select([1, 2, 3], [2, 3, 3])
+        self.assertTrue(np.array_equal(m[1:3, 2:5, 3:6], sel.read()))
+
+        with self.assertRaises(ValueError):
+            dset.read(out=np.empty(10))
+        with self.assertRaises(ValueError):
+            dset.read(out=np.empty(m.shape, order='F'))
+
+    def test_write_dispatch(self):
+        file_name = 'tmp/test_write_dispatch.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        dset = file.createDataSet('data', 6, h5gt.AtomicFloat())
+        for dtype in (np.int8, np.uint16, np.int32, np.int64, np.float32, np.float64):
+            v = np.arange(6, dtype=dtype)
+            dset.write(v)
+            self.assertListEqual(dset.read().tolist(), v.tolist())
+        dset.write([0.5, 1.5, 2.5, 3.5, 4.5, 5.5])
+        self.assertListEqual(dset.read().tolist(), [0.5, 1.5, 2.5, 3.5, 4.5, 5.5])
+        self.assertEqual(dset.read(dtype=np.int16).dtype, np.int16)
+
+        with self.assertRaises(h5gt.Exception):
+            dset.write(np.arange(5, dtype=np.float32))
+        with self.assertRaises(TypeError):
+            dset.write([object()])
+
+        dset = file.createDataSet('data_str', 3, h5gt.AtomicStr())
+        dset.write(['a', 'bb', 'ccc'])
+        self.assertListEqual(dset.readStr(), ['a', 'bb', 'ccc'])
+
+    def test_threaded_io(self):
+        file_name = 'tmp/test_threaded_io.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        m = np.random.rand(8, 1000)
+        dsets = [file.createDataSet(f'data_{i}', list(m.shape), h5gt.AtomicDouble())
+                 for i in range(4)]
+        sels = [dset.select([0, 0], list(m.shape)) for dset in dsets]
+        outs = [np.empty_like(m) for _ in dsets]
+
+        def write_read(i):
+            for _ in range(10):
+                dsets[i].write_raw(m * i)
+                sels[i].read(out=outs[i])
+                dsets[i].flush()
+                # not guarded bindings running along with I/O in other threads
+                self.assertListEqual(file.getDataSet(f'data_{i}').getDimensions(), list(m.shape))
+
+        threads = [threading.Thread(target=write_read, args=(i,)) for i in range(len(dsets))]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for i, out in enumerate(outs):
+            self.assertTrue(np.array_equal(m * i, out))
+
+    def test_getitem_setitem(self):
+        file_name = 'tmp/test_getitem_setitem.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        m = np.arange(4 * 6 * 5, dtype=np.int32).reshape(4, 6, 5)
+        dset = file.createDataSet('data', list(m.shape), h5gt.AtomicInt())
+        dset.write(m)
+
+        keys = [(), 1, -1, (1, 2, 3), (slice(None), 2), (slice(1, None, 2), slice(None, None, -2)),
+                (Ellipsis, 3), (0, Ellipsis, slice(4, 0, -3)), [3, 0, 0, 2], (slice(None), [5, 1, 1]),
+                (1, [4, 2]), (1, slice(None), [4, 2]), (slice(None, None, -1), np.array([-1, 0])),
+                (np.array([True, False, True, False]), 2), (slice(None), [])]
+        for key in keys:
+            res = dset[key]
+            self.assertEqual(res.dtype, np.int32)
+            self.assertTrue(np.array_equal(res, m[key]), key)
+        self.assertEqual(dset[1, 2, 3], m[1, 2, 3])
+
+        for key in [(0, 0, 0, 0), 4, (slice(None), [6]), ([0], [0]), ('a',), (Ellipsis, Ellipsis)]:
+            with self.assertRaises(IndexError):
+                dset[key]
+
+        # value is broadcasted, duplicates are written in the given order
+        v = np.repeat([[-1], [-2], [-3]], 6, axis=1)
+        dset[1, :, [4, 0, 4]] = v
+        m[1, :, [4, 0, 4]] = v
+        self.assertTrue(np.array_equal(dset[1, :, 4], np.full(6, -3)))
+        dset[0] = 7
+        m[0] = 7
+        dset[::-2, 1] = np.arange(10).reshape(2, 5)
+        m[::-2, 1] = np.arange(10).reshape(2, 5)
+        dset[...] = dset[...]
+        self.assertTrue(np.array_equal(dset.read(), m))
+
+        sel = dset.select([1, 0, 0], [2, 6, 5])
+        self.assertTrue(np.array_equal(sel[:, [3, 1], ::2], m[1:3, [3, 1], ::2]))
+        sel[0, 0] = 100
+        m[1, 0] = 100
+        self.assertTrue(np.array_equal(dset.read(), m))
+
+    def test_compound_numpy(self):
+        file_name = 'tmp/test_compound_numpy.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+        dt = np.dtype([('id', 'i4'), ('x', 'f8'), ('name', 'S8'), ('v', 'f4', (3,)), ('c', 'c16')], align=True)
+        arr = np.zeros(10, dtype=dt)
+        arr['id'] = np.arange(10)
+        arr['x'] = np.random.rand(10)
+        arr['name'] = [f'trace_{i}'.encode() for i in range(10)]
+        arr['v'] = np.random.rand(10, 3)
+        arr['c'] = np.random.rand(10) + 1j
+
+        ctype = h5gt.CompoundType.fromNumpy(dt)
+        ctype.commit(file, 'header_t')
+        committed = file.getDataType('header_t')
+        self.assertEqual(committed.toNumpy(), dt)
+
+        dset = file.createDataSet('headers', list(arr.shape), committed)
+        dset.write(arr)
+        out = dset.read()
+        self.assertEqual(out.dtype, dt)
+        for name in dt.names:
+            self.assertTrue(np.array_equal(out[name], arr[name]), name)
+        self.assertTrue(np.array_equal(dset[[7, 2]]['x'], arr[[7, 2]]['x']))
+
+        # packed dtype is converted by field names
+        packed = np.zeros(10, dtype=[('x', 'f8'), ('id', 'i2')])
+        dset.read(out=packed)
+        self.assertTrue(np.array_equal(packed['x'], arr['x']))
+        self.assertTrue(np.array_equal(packed['id'], arr['id']))
+
+        with self.assertRaises(TypeError):
+            h5gt.CompoundType.fromNumpy(np.dtype('f8'))
+
+    def test_default_props(self):
+        file_name = 'tmp/test_default_props.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+
+        self.assertTrue(h5gt.DataSetAccessProps.Default().isDefault())
+        self.assertFalse(h5gt.DataSetAccessProps().isDefault())
+        self.assertFalse(h5gt.LinkCreateProps.Default().isDefault())
+
+        dset = file.createDataSet('path/to/data', 3, h5gt.AtomicDouble())
+        self.assertTrue(file.hasObject('path/to/data', h5gt.ObjectType.Dataset))
+        dset = file.getDataSet('path/to/data', h5gt.DataSetAccessProps.Default())
+        self.assertEqual(dset.getPath(), '/path/to/data')
+
+    def test_chunk_info(self):
+        file_name = 'tmp/test_chunk_info.h5'
+
+        file = h5gt.File(file_name, h5gt.OpenFlag(h5gt.ReadWrite | h5gt.Create | h5gt.Truncate))
+
+        props = h5gt.DataSetCreateProps()
+        props.setChunk([4, 4])
+        dset = file.createDataSet('data', [10, 8], h5gt.AtomicInt(), dsetCreateProps=props)
+        self.assertEqual(dset.getNumberChunks(), 0)
+
+        m = np.arange(4 * 8, dtype=np.int32).reshape(4, 8)
+        dset.select([4, 0], [4, 8]).write(m)
+        self.assertEqual(dset.getNumberChunks(), 2)
+
+        chunks = dset.listChunks()
+        self.assertListEqual([c.getOffset() for c in chunks], [[4, 0], [4, 4]])
+        self.assertTrue(all(c.isAllocated() and c.getStorageSize() > 0 for c in chunks))
+
+        blocks = []
+        dset.forEachChunkBlock(lambda sel, info: blocks.append((info.getOffset(), info.isAllocated())))
+        self.assertEqual(len(blocks), 6)
+        self.assertListEqual([b[1] for b in blocks], [True, True, False, False, False, False])
+
     def test_exception(self):
         file_name = 'tmp/test_exception.h5'
 
@@ -1,6 +1,18 @@
 #include <gtest/gtest.h>
 
+#ifdef H5GT_PARALLEL
+#include <mpi.h>
+#endif
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+#ifdef H5GT_PARALLEL
+  // once per process: parallel tests share the MPI environment
+  MPI_Init(&argc, &argv);
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+  return result;
+#else
   return RUN_ALL_TESTS();
+#endif
 }
@@ -19,9 +19,11 @@
 #include <vector>
 #include <fstream>
 
+#include <h5gt/H5AppendableDataSet.hpp>
 #include <h5gt/H5DataSet.hpp>
 #include <h5gt/H5DataSpace.hpp>
 #include <h5gt/H5File.hpp>
+#include <h5gt/H5Filter.hpp>
 #include <h5gt/H5Group.hpp>
 #include <h5gt/H5Reference.hpp>
 #include <h5gt/H5Utility.hpp>
@@ -1019,6 +1021,130 @@ TEST(H5GTBase, columnSelectionTest) {
   columnSelectionTest<std::complex<double> >();
 }
 
+TEST(H5GTBase, IndexSet) {
+  IndexSet sorted({1, 2, 3, 7});
+  ASSERT_TRUE(sorted.getPermutation().empty());
+  ASSERT_EQ(sorted.getBlocks().size(), 2);
+
+  // consecutive runs and regular strides
+  IndexSet set({20, 0, 1, 2, 10, 11, 12, 21, 22, 30, 40, 50, 1});
+  ASSERT_EQ(set.size(), 13);
+  ASSERT_THAT(set.getUniqueIndices(),
+              ::testing::ElementsAre(0, 1, 2, 10, 11, 12, 20, 21, 22, 30, 40, 50));
+  ASSERT_THAT(set.getPermutation(),
+              ::testing::ElementsAre(6, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 1));
+
+  const auto& blocks = set.getBlocks();
+  ASSERT_EQ(blocks.size(), 2);
+  ASSERT_EQ(blocks[0].start, 0);
+  ASSERT_EQ(blocks[0].stride, 10);
+  ASSERT_EQ(blocks[0].count, 3);
+  ASSERT_EQ(blocks[0].block, 3);
+  ASSERT_EQ(blocks[1].start, 30);
+  ASSERT_EQ(blocks[1].stride, 10);
+  ASSERT_EQ(blocks[1].count, 3);
+  ASSERT_EQ(blocks[1].block, 1);
+}
+
+TEST(H5GTBase, selectRowsColsOrder) {
+  File file("select_rows_cols_order.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  const size_t nrows = 10, ncols = 4;
+  std::vector<std::vector<int>> values(nrows, std::vector<int>(ncols));
+  for (size_t i = 0; i < nrows; i++)
+    for (size_t j = 0; j < ncols; j++)
+      values[i][j] = int(i * ncols + j);
+
+  DataSet dset = file.createDataSet<int>("data", DataSpace::From(values));
+  dset.write(values);
+
+  // rows are read in the given order, duplicates included
+  std::vector<size_t> rows{7, 2, 3, 2, 9};
+  std::vector<std::vector<int>> result;
+  dset.select_rows(rows).read(result);
+  ASSERT_EQ(result.size(), rows.size());
+  for (size_t i = 0; i < rows.size(); i++)
+    ASSERT_THAT(result[i], ::testing::ElementsAreArray(values[rows[i]]));
+
+  dset.select_rows(rows, 1, 2).read(result);
+  for (size_t i = 0; i < rows.size(); i++)
+    ASSERT_THAT(result[i], ::testing::ElementsAre(values[rows[i]][1], values[rows[i]][2]));
+
+  std::vector<size_t> cols{3, 0, 2};
+  dset.select_cols(cols).read(result);
+  ASSERT_EQ(result.size(), nrows);
+  for (size_t i = 0; i < nrows; i++)
+    for (size_t j = 0; j < cols.size(); j++)
+      ASSERT_EQ(result[i][j], values[i][cols[j]]);
+
+  // rows are written in the given order
+  std::vector<std::vector<int>> rows_in{{-1, -1, -1, -1}, {-2, -2, -2, -2}};
+  dset.select_rows({5, 0}).write(rows_in);
+  dset.select_rows({0, 5}).read(result);
+  ASSERT_THAT(result[0], ::testing::ElementsAreArray(rows_in[1]));
+  ASSERT_THAT(result[1], ::testing::ElementsAreArray(rows_in[0]));
+
+  // unique elements of 1D datasets are selected as hyperslabs
+  std::vector<double> vec{0, 1, 2, 3, 4, 5, 6, 7};
+  DataSet dset_1d = file.createDataSet<double>("data_1d", DataSpace::From(vec));
+  dset_1d.write(vec);
+  std::vector<double> vec_out;
+  dset_1d.select(ElementSet({6, 1, 2, 3})).read(vec_out);
+  ASSERT_THAT(vec_out, ::testing::ElementsAre(6, 1, 2, 3));
+  dset_1d.select(ElementSet({6, 1, 6})).read(vec_out);
+  ASSERT_THAT(vec_out, ::testing::ElementsAre(6, 1, 6));
+
+  // variable length data can't be duplicated
+  std::vector<std::string> strings{"a", "b", "c"};
+  DataSet dset_str = file.createDataSet<std::string>("str", DataSpace::From(strings));
+  dset_str.write(strings);
+  std::vector<std::string> strings_out;
+  dset_str.select_rows({2, 0}).read(strings_out);
+  ASSERT_THAT(strings_out, ::testing::ElementsAre("c", "a"));
+  ASSERT_THROW(dset_str.select_rows({2, 2}).read(strings_out), DataSetException);
+}
+
+TEST(H5GTBase, selectAlong) {
+  File file("select_along.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  const size_t nx = 4, ny = 6, nz = 5;
+  std::vector<int> values(nx * ny * nz);
+  for (size_t i = 0; i < values.size(); i++)
+    values[i] = int(i);
+
+  DataSet dset = file.createDataSet<int>("data", DataSpace({nx, ny, nz}));
+  dset.write_raw(values.data());
+
+  // indices along the middle axis, strided elements along the others
+  std::vector<size_t> ind{4, 1, 1, 5};
+  Selection sel = dset.select_along(1, ind, {1, 0, 0}, {2, 0, 3}, {2, 1, 2});
+  ASSERT_THAT(sel.getMemSpace().getDimensions(), ::testing::ElementsAre(2, 4, 3));
+
+  std::vector<int> result(2 * ind.size() * 3);
+  sel.read(result.data());
+  for (size_t i = 0; i < 2; i++)
+    for (size_t j = 0; j < ind.size(); j++)
+      for (size_t k = 0; k < 3; k++)
+        ASSERT_EQ(result[(i * ind.size() + j) * 3 + k],
+                  values[((1 + 2 * i) * ny + ind[j]) * nz + 2 * k]);
+
+  // written in the given order
+  std::vector<int> rows_in(nx * 2 * nz);
+  for (size_t i = 0; i < rows_in.size(); i++)
+    rows_in[i] = -int(i) - 1;
+  dset.select_along(1, {3, 0}, {0, 0, 0}, {nx, 0, nz}).write_raw(rows_in.data());
+  dset.read(values.data());
+  for (size_t i = 0; i < nx; i++)
+    for (size_t k = 0; k < nz; k++) {
+      ASSERT_EQ(values[(i * ny + 3) * nz + k], rows_in[(i * 2 + 0) * nz + k]);
+      ASSERT_EQ(values[(i * ny + 0) * nz + k], rows_in[(i * 2 + 1) * nz + k]);
+    }
+
+  ASSERT_THROW(dset.select_along(3, ind, {0, 0, 0}, {1, 1, 1}), DataSpaceException);
+  ASSERT_THROW(dset.select_along(0, ind, {0, 0}, {1, 1}), DataSpaceException);
+  ASSERT_THROW(dset.select_along(0, ind, {0, 0, 0}, {1, 1, 1}, {1}), DataSpaceException);
+}
+
 template <typename T>
 void attribute_scalar_rw() {
   std::ostringstream filename;
@@ -1408,6 +1534,863 @@ TEST(H5GTBase, GetDatasetProps) {
   ASSERT_TRUE(dset.getCreateProps().isContiguous());
 }
 
+TEST(H5GTBase, DataTransferProps) {
+  File file("xferProps.h5", File::ReadWrite | File::Create | File::Truncate);
+  std::vector<double> data{1, 2, 3, 4, 5, 6};
+  DataSet dset = file.createDataSet<double>(
+        "data", DataSpace::From(data));
+
+  DataTransferProps xferProps;
+  xferProps.setBuffer(4 * 1024 * 1024);
+  ASSERT_EQ(xferProps.getBufferSize(), 4 * 1024 * 1024);
+  xferProps.setHyperVectorSize(2048);
+  ASSERT_EQ(xferProps.getHyperVectorSize(), 2048);
+  xferProps.setEDCCheck(false);
+  ASSERT_FALSE(xferProps.getEDCCheck());
+  ASSERT_TRUE(xferProps.getDataTransform().empty());
+
+  // values are stored multiplied by 2
+  xferProps.setDataTransform("2*x");
+  ASSERT_EQ(xferProps.getDataTransform(), "2*x");
+  dset.write(data, xferProps);
+
+  std::vector<double> result;
+  dset.read(result);
+  for (size_t i = 0; i < data.size(); i++)
+    ASSERT_EQ(result[i], 2 * data[i]);
+
+  // and divided by 2 when read back
+  DataTransferProps readProps;
+  readProps.setDataTransform("x/2");
+  dset.select({2}, {3}).read(result, readProps);
+  ASSERT_THAT(result, ::testing::ElementsAre(3, 4, 5));
+
+  std::vector<double> raw(data.size());
+  dset.read(raw.data(), AtomicType<double>(), readProps);
+  ASSERT_THAT(raw, ::testing::ElementsAreArray(data));
+}
+
+TEST(H5GTBase, DataTypeRegistry) {
+  DataTypeRegistry::invalidate();
+  DataTypeRegistry::resetCounters();
+
+  DataType t1 = create_and_check_datatype<int>();
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 1);
+  ASSERT_EQ(DataTypeRegistry::getHitCount(), 0);
+
+  // the same HDF5 id is shared between the callers
+  DataType t2 = create_and_check_datatype<int>();
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 1);
+  ASSERT_EQ(DataTypeRegistry::getHitCount(), 1);
+  ASSERT_EQ(t1.getId(false), t2.getId(false));
+  ASSERT_TRUE(H5Tequal(t1.getId(false), AtomicType<int>().getId(false)) > 0);
+
+  // checked and unchecked types are cached separately
+  DataType t3 = DataTypeRegistry::get<int>();
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 2);
+  ASSERT_NE(t3.getId(false), t1.getId(false));
+
+  File file("datatype_registry.h5", File::ReadWrite | File::Create | File::Truncate);
+  std::vector<int> data{1, 2, 3};
+  DataSet dset = file.createDataSet<int>("data", DataSpace::From(data));
+  dset.write(data);
+  std::vector<int> result;
+  dset.read(result);
+  ASSERT_THAT(result, ::testing::ElementsAreArray(data));
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 2);
+  ASSERT_GT(DataTypeRegistry::getHitCount(), 1);
+
+  // types are rebuilt after invalidation
+  DataTypeRegistry::invalidate();
+  DataTypeRegistry::resetCounters();
+  DataType t4 = create_and_check_datatype<int>();
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 1);
+  ASSERT_NE(t4.getId(false), t1.getId(false));
+  ASSERT_TRUE(H5Tequal(t4.getId(false), t1.getId(false)) > 0);
+
+  // cached handles are closed by invalidation
+  const hid_t stale = create_and_check_datatype<short>().getId(false);
+  DataTypeRegistry::invalidate();
+  ASSERT_LE(H5Iis_valid(stale), 0);
+}
+
+TEST(H5GTBase, DefaultPropertyLists) {
+  ASSERT_TRUE(DataSetAccessProps::Default().isDefault());
+  ASSERT_EQ(DataSetAccessProps::Default().getId(), H5P_DEFAULT);
+  ASSERT_EQ(&DataSetCreateProps::Default(), &DataSetCreateProps::Default());
+  ASSERT_FALSE(DataSetCreateProps().isDefault());
+
+  // copying default lists doesn't touch reference counters
+  DataTransferProps xferProps = DataTransferProps::Default();
+  ASSERT_TRUE(xferProps.isDefault());
+  ASSERT_EQ(xferProps.getId(true), H5P_DEFAULT);
+
+  DataTransferProps xferProps2;
+  hid_t hid = xferProps2.getId();
+  xferProps2 = xferProps;
+  ASSERT_TRUE(xferProps2.isDefault());
+  ASSERT_FALSE(H5Iis_valid(hid) > 0);
+
+  xferProps2 = DataTransferProps();
+  ASSERT_FALSE(xferProps2.isDefault());
+  xferProps2.setBuffer(2 * 1024 * 1024);
+
+  DataTransferProps xferProps3(std::move(xferProps2));
+  ASSERT_EQ(xferProps3.getBufferSize(), 2 * 1024 * 1024);
+
+  // default lists are read-only
+  ASSERT_THROW(xferProps.setBuffer(1024), PropertyException);
+
+  // unlike `H5P_DEFAULT` link creation defaults create intermediate groups
+  ASSERT_FALSE(LinkCreateProps::Default().isDefault());
+  // and are not shared: no id is kept after `H5close()`
+  LinkCreateProps linkCreateProps = LinkCreateProps::Default();
+  ASSERT_NE(linkCreateProps.getId(false), LinkCreateProps::Default().getId(false));
+
+  File file("default_props.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet<int>("path/to/data", DataSpace(1));
+  dset.write(5);
+  ASSERT_TRUE(file.hasObject("path/to/data", ObjectType::Dataset));
+
+  int result = 0;
+  file.getDataSet("path/to/data").read(result);
+  ASSERT_EQ(result, 5);
+  ASSERT_FALSE(dset.getCreateProps().isDefault());
+}
+
+TEST(H5GTBase, writeParallel) {
+  File file("write_parallel.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  // extent isn't a multiple of chunk dims to check edge chunks
+  const std::vector<size_t> dims{37, 29};
+  std::vector<float> data(dims[0] * dims[1]);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = float(i % 97) * 0.5f;
+
+  DataSetCreateProps props;
+  props.setChunk({8, 8});
+  props.setShuffle();
+  props.setDeflate(6);
+
+  DataSet dset_ref = file.createDataSet<float>("ref", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset_ref.write_raw(data.data());
+
+  DataSet dset = file.createDataSet<float>("parallel", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset.writeParallel(data.data(), {0, 0}, dims, 4);
+
+  std::vector<float> result(data.size());
+  dset.read(result.data());
+  ASSERT_THAT(result, ::testing::ElementsAreArray(data));
+  ASSERT_EQ(dset.getStorageSize(), dset_ref.getStorageSize());
+
+  // chunks are byte-compatible with HDF5 filter pipeline
+  for (hsize_t i = 0; i < dims[0]; i += 8) {
+    for (hsize_t j = 0; j < dims[1]; j += 8) {
+      std::vector<hsize_t> coff{i, j};
+      hsize_t nbytes, nbytes_ref;
+      ASSERT_GE(H5Dget_chunk_storage_size(dset.getId(false), coff.data(), &nbytes), 0);
+      ASSERT_GE(H5Dget_chunk_storage_size(dset_ref.getId(false), coff.data(), &nbytes_ref), 0);
+      ASSERT_EQ(nbytes, nbytes_ref);
+
+      std::vector<char> chunk(nbytes), chunk_ref(nbytes_ref);
+      uint32_t mask, mask_ref;
+      H5Dread_chunk(dset.getId(false), H5P_DEFAULT, coff.data(), &mask, chunk.data());
+      H5Dread_chunk(dset_ref.getId(false), H5P_DEFAULT, coff.data(), &mask_ref, chunk_ref.data());
+      ASSERT_EQ(mask, mask_ref);
+      ASSERT_EQ(chunk, chunk_ref);
+    }
+  }
+
+  // chunk aligned part of the dataset
+  std::vector<float> part(16 * 8, -1);
+  dset.writeParallel(part.data(), {8, 16}, {16, 8});
+  dset.select({8, 16}, {16, 8}).read(result.data());
+  ASSERT_THAT(std::vector<float>(result.begin(), result.begin() + part.size()),
+              ::testing::ElementsAreArray(part));
+
+  // not aligned box falls back to HDF5 pipeline
+  dset.writeParallel(part.data(), {1, 2}, {16, 8});
+  dset.select({1, 2}, {16, 8}).read(result.data());
+  ASSERT_THAT(std::vector<float>(result.begin(), result.begin() + part.size()),
+              ::testing::ElementsAreArray(part));
+}
+
+TEST(H5GTBase, readParallel) {
+  File file("read_parallel.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  // extent isn't a multiple of chunk dims to check edge chunks
+  const std::vector<size_t> dims{37, 29};
+  std::vector<float> data(dims[0] * dims[1]);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = float(i % 97) * 0.5f;
+
+  DataSetCreateProps props;
+  props.setChunk({8, 8});
+  props.setShuffle();
+  props.setDeflate(6);
+  const float fill_value = -3.0f;
+  H5Pset_fill_value(props.getId(false), H5T_NATIVE_FLOAT, &fill_value);
+
+  // the last rows are never written so their chunks aren't allocated
+  DataSet dset = file.createDataSet<float>("data", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset.select({0, 0}, {24, dims[1]}).write_raw(data.data());
+
+  std::vector<float> expected(data.size());
+  dset.read(expected.data());
+  ASSERT_EQ(expected.back(), -3.0f);
+
+  std::vector<float> result(data.size());
+  dset.readParallel(result.data(), 4);
+  ASSERT_THAT(result, ::testing::ElementsAreArray(expected));
+
+  std::vector<std::vector<float>> result2d, expected2d;
+  dset.read(expected2d);
+  dset.readParallel(result2d, 3);
+  ASSERT_EQ(result2d, expected2d);
+
+  // box that isn't chunk aligned
+  Selection sel = dset.select({5, 3}, {30, 20});
+  expected.assign(30 * 20, 0);
+  result.assign(30 * 20, 0);
+  sel.read(expected.data());
+  sel.readParallel(result.data(), 2);
+  ASSERT_THAT(result, ::testing::ElementsAreArray(expected));
+
+  // permuted rows fall back to HDF5 read
+  Selection rows = dset.select_rows({30, 2, 17, 2});
+  rows.read(expected2d);
+  rows.readParallel(result2d);
+  ASSERT_EQ(result2d, expected2d);
+
+#ifdef H5GT_USE_EIGEN
+  Eigen::MatrixXf mat, mat_expected;
+  sel.read(mat_expected);
+  sel.readParallel(mat, 4);
+  ASSERT_TRUE(mat == mat_expected);
+#endif
+}
+
+TEST(H5GTBase, ChunkInfo) {
+  File file("chunk_info.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  const std::vector<size_t> dims{20, 13};
+  DataSetCreateProps props;
+  props.setChunk({8, 5});
+  props.setDeflate(1);
+
+  DataSet dset = file.createDataSet<int>("data", DataSpace(dims), LinkCreateProps::Default(), props);
+  ASSERT_EQ(dset.getNumberChunks(), 0);
+  ASSERT_TRUE(dset.listChunks().empty());
+
+  // chunks are written in reversed order so that storage order
+  // differs from logical order, the last chunk row is left unallocated
+  std::vector<int> block(8 * 5);
+  for (int i = 1; i >= 0; i--) {
+    for (int j = 2; j >= 0; j--) {
+      std::iota(block.begin(), block.end(), 100 * (i * 3 + j));
+      dset.select({size_t(i) * 8, size_t(j) * 5},
+                  {8, std::min<size_t>(5, dims[1] - size_t(j) * 5)}).write_raw(block.data());
+    }
+  }
+
+  ASSERT_EQ(dset.getNumberChunks(), 6);
+  std::vector<ChunkInfo> chunks = dset.listChunks();
+  ASSERT_EQ(chunks.size(), 6);
+  for (size_t n = 0; n < chunks.size(); n++) {
+    ASSERT_EQ(chunks[n].getOffset(), std::vector<size_t>({n / 3 * 8, n % 3 * 5}));
+    ASSERT_TRUE(chunks[n].isAllocated());
+    ASSERT_GT(chunks[n].getStorageSize(), 0);
+    ASSERT_EQ(chunks[n].getFilterMask(), 0);
+  }
+
+  std::vector<ChunkInfo> stored = dset.listChunks(true);
+  ASSERT_EQ(stored.size(), 6);
+  for (size_t n = 1; n < stored.size(); n++)
+    ASSERT_LT(stored[n - 1].getAddress(), stored[n].getAddress());
+  ASSERT_NE(stored.front().getOffset(), chunks.front().getOffset());
+
+  // chunk blocks cover the whole dataset
+  std::vector<std::vector<int>> expected, result(dims[0], std::vector<int>(dims[1], -1));
+  dset.read(expected);
+  size_t nblocks = 0, nallocated = 0;
+  haddr_t prev_address = 0;
+  dset.forEachChunkBlock([&](const Selection& sel, const ChunkInfo& info) {
+    ASSERT_GE(info.getAddress(), prev_address);
+    prev_address = info.getAddress();
+    nblocks++;
+    nallocated += info.isAllocated();
+
+    std::vector<std::vector<int>> data;
+    sel.read(data);
+    for (size_t i = 0; i < data.size(); i++)
+      for (size_t j = 0; j < data[i].size(); j++)
+        result[info.getOffset()[0] + i][info.getOffset()[1] + j] = data[i][j];
+  });
+  ASSERT_EQ(nblocks, 9);
+  ASSERT_EQ(nallocated, 6);
+  ASSERT_EQ(result, expected);
+
+  // contiguous dataset has no chunks
+  DataSet contiguous = file.createDataSet<int>("contiguous", DataSpace(dims));
+  ASSERT_THROW(contiguous.listChunks(), DataSetException);
+}
+
+TEST(H5GTBase, AppendableDataSet) {
+  File file("appendable_dataset.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  // 1D stream of values appended one by one
+  {
+    auto stream = AppendableDataSet<int>::create(file, "stream", {}, 0, 16);
+    ASSERT_EQ(stream.getRecordSize(), 1);
+    for (int i = 0; i < 1000; i++)
+      stream.append(i);
+    ASSERT_EQ(stream.size(), 1000);
+
+    // the extent grows geometrically and is chunk aligned
+    stream.flush();
+    const size_t extent = stream.getDataSet().getDimensions()[0];
+    ASSERT_GE(extent, 1000);
+    ASSERT_LT(extent, 2000);
+    ASSERT_EQ(extent % 16, 0);
+
+    stream.close();
+    ASSERT_EQ(stream.getDataSet().getDimensions(), std::vector<size_t>({1000}));
+  }
+
+  std::vector<int> values;
+  file.getDataSet("stream").read(values);
+  ASSERT_EQ(values.size(), 1000);
+  for (int i = 0; i < 1000; i++)
+    ASSERT_EQ(values[i], i);
+
+  // appending to existing dataset, the extent is trimmed in destructor
+  {
+    AppendableDataSet<int> stream(file.getDataSet("stream"), 0, 5);
+    ASSERT_EQ(stream.size(), 1000);
+    std::vector<int> more(37);
+    std::iota(more.begin(), more.end(), 1000);
+    stream.append(more);
+    stream.append(more.data(), 3);
+  }
+  file.getDataSet("stream").read(values);
+  ASSERT_EQ(values.size(), 1040);
+  ASSERT_EQ(values[1036], 1036);
+  ASSERT_EQ(values[1039], 1002);
+
+  // 2D rows appended along the first axis
+  {
+    auto rows = AppendableDataSet<double>::create(file, "rows", {3});
+    for (size_t i = 0; i < 100; i++)
+      rows.append(std::vector<double>{double(i), i + 0.5, i + 0.25});
+  }
+  std::vector<std::vector<double>> matrix;
+  file.getDataSet("rows").read(matrix);
+  ASSERT_EQ(matrix.size(), 100);
+  ASSERT_EQ(matrix[42], std::vector<double>({42, 42.5, 42.25}));
+
+  // 3D records of shape {2, 3} appended along the middle axis
+  {
+    DataSetCreateProps props;
+    props.setChunk({2, 4, 3});
+    props.setDeflate(1);
+    auto slices = AppendableDataSet<float>::create(file, "slices", {2, 3}, 1, 0, props);
+    ASSERT_EQ(slices.getRecordSize(), 6);
+    std::vector<float> record(6);
+    for (size_t r = 0; r < 10; r++) {
+      for (size_t k = 0; k < record.size(); k++)
+        record[k] = float(r * 10 + k);
+      slices.append(record.data());
+    }
+  }
+  DataSet slices = file.getDataSet("slices");
+  ASSERT_EQ(slices.getDimensions(), std::vector<size_t>({2, 10, 3}));
+  std::vector<std::vector<std::vector<float>>> cube;
+  slices.read(cube);
+  for (size_t o = 0; o < 2; o++)
+    for (size_t r = 0; r < 10; r++)
+      for (size_t i = 0; i < 3; i++)
+        ASSERT_EQ(cube[o][r][i], float(r * 10 + o * 3 + i));
+
+  // append axis must be unlimited
+  DataSet fixed = file.createDataSet<int>("fixed", DataSpace({10}));
+  ASSERT_THROW(AppendableDataSet<int>{fixed}, DataSetException);
+}
+
+TEST(H5GTBase, mapReadOnly) {
+  const std::string file_name("map_read_only.h5");
+  const std::vector<size_t> dims{40, 25};
+  std::vector<double> data(dims[0] * dims[1]);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = double(i) * 0.25;
+
+  {
+    File file(file_name, File::ReadWrite | File::Create | File::Truncate);
+    file.createDataSet<double>("contiguous", DataSpace(dims)).write_raw(data.data());
+
+    DataSetCreateProps props;
+    props.setChunk({8, 8});
+    file.createDataSet<double>("chunked", DataSpace(dims), LinkCreateProps::Default(), props)
+        .write_raw(data.data());
+
+    // big-endian values need conversion
+    DataSet be = file.createDataSet("big_endian", DataSpace(dims),
+                                    DataType::FromId(H5Tcopy(H5T_IEEE_F64BE)));
+    be.write_raw(data.data());
+
+    // file is writable so it's read with HDF5
+    DataSetView<double> view = file.getDataSet("contiguous").mapReadOnly<double>();
+    ASSERT_FALSE(view.isMapped());
+    ASSERT_EQ(view[7], data[7]);
+  }
+
+  File file(file_name, File::ReadOnly);
+  DataSetView<double> view = file.getDataSet("contiguous").mapReadOnly<double>();
+#if defined(__unix__) || defined(__APPLE__)
+  ASSERT_TRUE(view.isMapped());
+#endif
+  ASSERT_EQ(view.getDimensions(), dims);
+  ASSERT_EQ(view.size(), data.size());
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), view.data()));
+  ASSERT_EQ(view(3, 4), data[3 * dims[1] + 4]);
+
+  for (const std::string name : {"chunked", "big_endian"}) {
+    DataSetView<double> fallback = file.getDataSet(name).mapReadOnly<double>();
+    ASSERT_FALSE(fallback.isMapped());
+    ASSERT_TRUE(std::equal(data.begin(), data.end(), fallback.data()));
+  }
+
+#ifdef H5GT_USE_EIGEN
+  DataSetView<double>::EigenMap mat = view.asEigen();
+  ASSERT_EQ(mat.rows(), dims[0]);
+  ASSERT_EQ(mat.cols(), dims[1]);
+  ASSERT_EQ(mat(3, 4), data[3 * dims[1] + 4]);
+#endif
+
+  // the view outlives the file
+  file = File(file_name, File::ReadOnly);
+  ASSERT_EQ(view(39, 24), data.back());
+}
+
+TEST(H5GTBase, FileDrivers) {
+  auto exists = [](const std::string& name) {
+    return std::ifstream(name).good();
+  };
+  const std::vector<int> data(1000, 7);
+  std::vector<int> result;
+
+  // core driver without backing store never touches the disk
+  std::remove("driver_core.h5");
+  {
+    CoreFileDriver driver(1 << 16);
+    ASSERT_EQ(driver.getIncrement(), 1 << 16);
+    ASSERT_FALSE(driver.getBackingStore());
+    File file("driver_core.h5", File::ReadWrite | File::Create | File::Truncate, driver);
+    file.createDataSet("data", data).write(data);
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+  ASSERT_FALSE(exists("driver_core.h5"));
+
+  {
+    File file("driver_core.h5", File::ReadWrite | File::Create | File::Truncate,
+              CoreFileDriver(1 << 16, true));
+    file.createDataSet("data", data).write(data);
+  }
+  {
+    File file("driver_core.h5", File::ReadOnly);
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+
+  // family members of 2 KiB
+  {
+    FamilyFileDriver driver(2048);
+    ASSERT_EQ(driver.getMemberSize(), 2048);
+    File file("driver_family_%d.h5", File::ReadWrite | File::Create | File::Truncate, driver);
+    file.createDataSet("data", data).write(data);
+  }
+  ASSERT_TRUE(exists("driver_family_0.h5"));
+  ASSERT_TRUE(exists("driver_family_1.h5"));
+  {
+    File file("driver_family_%d.h5", File::ReadOnly, FamilyFileDriver(2048));
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+
+  // metadata and raw data in separate files
+  {
+    File file("driver_split", File::ReadWrite | File::Create | File::Truncate,
+              SplitFileDriver(".meta.h5", ".raw.h5"));
+    file.createDataSet("data", data).write(data);
+  }
+  ASSERT_TRUE(exists("driver_split.meta.h5"));
+  ASSERT_TRUE(exists("driver_split.raw.h5"));
+  {
+    File file("driver_split", File::ReadOnly, SplitFileDriver(".meta.h5", ".raw.h5"));
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+
+  // big objects are aligned
+  {
+    Sec2FileDriver driver(1024, 4096);
+    hsize_t threshold, alignment;
+    driver.getAlignment(threshold, alignment);
+    ASSERT_EQ(threshold, 1024);
+    ASSERT_EQ(alignment, 4096);
+    File file("driver_sec2.h5", File::ReadWrite | File::Create | File::Truncate, driver);
+    DataSet dset = file.createDataSet("data", data);
+    dset.write(data);
+    ASSERT_EQ(dset.getOffset() % 4096, 0);
+  }
+
+#ifdef H5_HAVE_DIRECT
+  {
+    DirectFileDriver driver;
+    size_t alignment, block_size, cbuf_size;
+    driver.getFaplDirect(alignment, block_size, cbuf_size);
+    ASSERT_EQ(alignment, 4096);
+    File file("driver_direct.h5", File::ReadWrite | File::Create | File::Truncate, driver);
+    file.createDataSet("data", data).write(data);
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+#endif
+}
+
+TEST(H5GTBase, FileTuningProps) {
+  const std::string FILE_NAME("h5_file_tuning.h5");
+  const std::vector<int> data(10000, 3);
+  std::vector<int> result;
+
+  FileCreateProps fcpl;
+  fcpl.setFileSpaceStrategy(H5F_FSPACE_STRATEGY_PAGE, true, 16);
+  fcpl.setFileSpacePageSize(8192);
+
+  H5F_fspace_strategy_t strategy;
+  bool persist;
+  hsize_t threshold;
+  fcpl.getFileSpaceStrategy(strategy, persist, threshold);
+  ASSERT_EQ(strategy, H5F_FSPACE_STRATEGY_PAGE);
+  ASSERT_TRUE(persist);
+  ASSERT_EQ(threshold, 16);
+  ASSERT_EQ(fcpl.getFileSpaceStrategy(), H5F_FSPACE_STRATEGY_PAGE);
+  ASSERT_EQ(fcpl.getFileSpacePageSize(), 8192);
+
+  FileAccessProps fapl;
+  fapl.setPageBufferSize(8 * 8192, 25, 50);
+  fapl.setAlignment(4096, 8192);
+  fapl.setMetaBlockSize(8192);
+  fapl.setSmallDataBlockSize(8192);
+  fapl.setSieveBufSize(1 << 20);
+  fapl.setLibverBounds(H5F_LIBVER_V110, H5F_LIBVER_LATEST);
+
+  size_t pageBufSize;
+  unsigned minMetaPerc, minRawPerc;
+  fapl.getPageBufferSize(pageBufSize, minMetaPerc, minRawPerc);
+  ASSERT_EQ(pageBufSize, 8 * 8192);
+  ASSERT_EQ(minMetaPerc, 25);
+  ASSERT_EQ(minRawPerc, 50);
+  ASSERT_EQ(fapl.getPageBufferSize(), 8 * 8192);
+
+  hsize_t alignment;
+  fapl.getAlignment(threshold, alignment);
+  ASSERT_EQ(threshold, 4096);
+  ASSERT_EQ(alignment, 8192);
+  ASSERT_EQ(fapl.getMetaBlockSize(), 8192);
+  ASSERT_EQ(fapl.getSmallDataBlockSize(), 8192);
+  ASSERT_EQ(fapl.getSieveBufSize(), 1 << 20);
+
+  H5F_libver_t low, high;
+  fapl.getLibverBounds(low, high);
+  ASSERT_EQ(low, H5F_LIBVER_V110);
+  ASSERT_EQ(high, H5F_LIBVER_LATEST);
+
+  {
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate,
+              FileAccessProps::Default(), fcpl);
+    file.createDataSet("data", data).write(data);
+
+    hid_t fcpl_id = H5Fget_create_plist(file.getId(false));
+    hsize_t pageSize;
+    H5Pget_file_space_page_size(fcpl_id, &pageSize);
+    H5Pclose(fcpl_id);
+    ASSERT_EQ(pageSize, 8192);
+  }
+
+  // page buffer may only be used with paged files
+  {
+    File file(FILE_NAME, File::ReadOnly, fapl);
+    file.getDataSet("data").read(result);
+    ASSERT_EQ(result, data);
+  }
+
+  // fcpl is ignored when the file is opened
+  {
+    File file(FILE_NAME, File::ReadWrite, fapl, FileCreateProps::Default());
+    DataSet dset = file.createDataSet("aligned", data);
+    dset.write(data);
+    ASSERT_EQ(dset.getOffset() % 8192, 0);
+  }
+}
+
+TEST(H5GTBase, MetadataCache) {
+  const std::string FILE_NAME("h5_mdc.h5");
+  const size_t nGroups = 200;
+
+  FileAccessProps fapl;
+  fapl.setMdcSize(size_t(4) << 20, size_t(1) << 20, size_t(64) << 20);
+  fapl.setMdcAutoResize(false);
+  fapl.setMdcImageConfig(true);
+  fapl.setLibverBounds(H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+  fapl.setEvictOnClose(false);
+
+  size_t initSize, minSize, maxSize;
+  fapl.getMdcSize(initSize, minSize, maxSize);
+  ASSERT_EQ(initSize, size_t(4) << 20);
+  ASSERT_EQ(minSize, size_t(1) << 20);
+  ASSERT_EQ(maxSize, size_t(64) << 20);
+  ASSERT_FALSE(fapl.getMdcAutoResize());
+  ASSERT_TRUE(fapl.getMdcImageGenerate());
+  ASSERT_FALSE(fapl.getEvictOnClose());
+
+  H5AC_cache_config_t config = fapl.getMdcConfig();
+  ASSERT_EQ(config.initial_size, size_t(4) << 20);
+  ASSERT_EQ(config.incr_mode, H5C_incr__off);
+
+  // file is closed with cache image
+  {
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate, fapl);
+    for (size_t i = 0; i < nGroups; i++)
+      file.createGroup("g" + std::to_string(i))
+          .createAttribute<int>("id", DataSpace(1)).write(int(i));
+
+    size_t maxCacheSize, minCleanSize, curSize;
+    int curNumEntries;
+    file.getMdcSize(maxCacheSize, minCleanSize, curSize, curNumEntries);
+    ASSERT_EQ(maxCacheSize, size_t(4) << 20);
+    ASSERT_GT(curSize, 0);
+    ASSERT_GT(curNumEntries, 0);
+    ASSERT_EQ(file.getMdcSize(), curSize);
+  }
+
+  // cache image is loaded on open
+  {
+    FileAccessProps evictProps;
+    evictProps.setEvictOnClose(true);
+    ASSERT_TRUE(evictProps.getEvictOnClose());
+
+    File file(FILE_NAME, File::ReadOnly, evictProps);
+    file.resetMdcHitRateStats();
+    int value;
+    for (size_t i = 0; i < nGroups; i++){
+      file.getGroup("g" + std::to_string(i)).getAttribute("id").read(value);
+      ASSERT_EQ(value, i);
+    }
+    ASSERT_GT(file.getMdcHitRate(), 0);
+    ASSERT_LE(file.getMdcHitRate(), 1);
+
+    H5AC_cache_config_t fileConfig = file.getMdcConfig();
+    fileConfig.set_initial_size = true;
+    fileConfig.initial_size = size_t(8) << 20;
+    fileConfig.max_size = size_t(16) << 20;
+    file.setMdcConfig(fileConfig);
+    ASSERT_EQ(file.getMdcConfig().max_size, size_t(16) << 20);
+  }
+}
+
+TEST(H5GTBase, FilterCodecs) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, 255);
+
+  for (size_t elemSize : {1, 2, 3, 4, 8, 12}) {
+    for (size_t nbytes : {size_t(0), size_t(5), size_t(64), size_t(200), size_t(1001)}) {
+      std::vector<char> src(nbytes), encoded(nbytes), decoded(nbytes);
+      for (auto& c : src)
+        c = char(dist(gen));
+      const size_t n = nbytes / elemSize;
+
+      // byte shuffle is identical to HDF5 shuffle filter
+      ByteShuffleFilter::encode(src.data(), encoded.data(), nbytes, elemSize);
+      if (n > 1) {
+        for (size_t i = 0; i < n; i++) {
+          for (size_t j = 0; j < elemSize; j++) {
+            ASSERT_EQ(encoded[j * n + i], src[i * elemSize + j]);
+          }
+        }
+      }
+      ByteShuffleFilter::decode(encoded.data(), decoded.data(), nbytes, elemSize);
+      ASSERT_EQ(decoded, src);
+
+      // bit `k` of byte `j` of element `i` goes to bit row `j * 8 + k`
+      BitShuffleFilter::encode(src.data(), encoded.data(), nbytes, elemSize);
+      const size_t n8 = n / 8 * 8;
+      for (size_t i = 0; i < n8; i++)
+        for (size_t j = 0; j < elemSize; j++)
+          for (size_t k = 0; k < 8; k++) {
+            const size_t pos = (j * 8 + k) * n8 + i;
+            ASSERT_EQ((encoded[pos / 8] >> (pos % 8)) & 1,
+                      (src[i * elemSize + j] >> k) & 1);
+          }
+      BitShuffleFilter::decode(encoded.data(), decoded.data(), nbytes, elemSize);
+      ASSERT_EQ(decoded, src);
+
+      DeltaFilter::encode(src.data(), encoded.data(), nbytes, elemSize);
+      DeltaFilter::decode(encoded.data(), decoded.data(), nbytes, elemSize);
+      ASSERT_EQ(decoded, src);
+    }
+  }
+
+  // delta of little-endian integers
+  const std::vector<int32_t> values{5, 7, 4, -1};
+  std::vector<int32_t> deltas(values.size());
+  DeltaFilter::encode(reinterpret_cast<const char*>(values.data()),
+                      reinterpret_cast<char*>(deltas.data()),
+                      values.size() * sizeof(int32_t), sizeof(int32_t));
+  ASSERT_THAT(deltas, ::testing::ElementsAre(5, 2, -3, -5));
+}
+
+TEST(H5GTBase, Filters) {
+  // predefined filters can't be replaced
+  ASSERT_THROW(registerFilter<ByteShuffleFilter>(), FilterException);
+  registerFilter<BitShuffleFilter>();
+  registerFilter<DeltaFilter>();
+  ASSERT_TRUE(isFilterAvailable(H5Z_FILTER_SHUFFLE));
+  ASSERT_TRUE(isFilterAvailable(BitShuffleFilter::id));
+  ASSERT_TRUE(isFilterAvailable(DeltaFilter::id));
+  ASSERT_FALSE(isFilterAvailable(400));
+  ASSERT_EQ(getFilterConfig(BitShuffleFilter::id),
+            H5Z_FILTER_CONFIG_ENCODE_ENABLED | H5Z_FILTER_CONFIG_DECODE_ENABLED);
+
+  File file("h5_filters.h5", File::ReadWrite | File::Create | File::Truncate);
+  const std::vector<size_t> dims{50, 40};
+  std::vector<float> data(dims[0] * dims[1]);
+  std::vector<int> ints(data.size());
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = std::sin(float(i) * 0.01f) * 1000.f;
+    ints[i] = int(i) * 3 + int(i % 7);
+  }
+
+  DataSetCreateProps props;
+  props.setChunk({16, 16});
+  props.setFilter(BitShuffleFilter::id);
+  props.setDeflate(4);
+  props.setFletcher32();
+  ASSERT_EQ(props.getFilterCount(), 3);
+  ASSERT_TRUE(props.hasFilter(BitShuffleFilter::id));
+  ASSERT_FALSE(props.hasFilter(DeltaFilter::id));
+
+  std::vector<FilterInfo> filters = props.getFilters();
+  ASSERT_EQ(filters[0].getId(), BitShuffleFilter::id);
+  ASSERT_EQ(filters[0].getName(), BitShuffleFilter::name());
+  ASSERT_FALSE(filters[0].isOptional());
+  ASSERT_EQ(filters[1].getId(), H5Z_FILTER_DEFLATE);
+  ASSERT_THAT(filters[1].getCdValues(), ::testing::ElementsAre(4));
+  ASSERT_EQ(filters[2].getId(), H5Z_FILTER_FLETCHER32);
+
+  DataSet dset = file.createDataSet<float>("bitshuffle", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset.write_raw(data.data());
+  std::vector<float> result(data.size());
+  dset.read(result.data());
+  ASSERT_EQ(result, data);
+  // element size and h5gt signature are stored by `set_local`
+  filters = dset.getCreateProps().getFilters();
+  ASSERT_THAT(filters[0].getCdValues(),
+              ::testing::ElementsAre(sizeof(float), details::codec_signature));
+
+  std::fill(result.begin(), result.end(), 0.f);
+  dset.readParallel(result.data(), 2);
+  ASSERT_EQ(result, data);
+
+  props.removeFilter(BitShuffleFilter::id);
+  props.removeFilter(H5Z_FILTER_FLETCHER32);
+  ASSERT_EQ(props.getFilterCount(), 1);
+  props.removeFilter(H5Z_FILTER_ALL);
+  props.setFilter(DeltaFilter::id);
+  props.setShuffle();
+  props.setDeflate(4);
+  dset = file.createDataSet<int>("delta", DataSpace(dims), LinkCreateProps::Default(), props);
+  dset.writeParallel(ints.data(), {0, 0}, dims, 2);
+  std::vector<int> intResult(ints.size());
+  dset.read(intResult.data());
+  ASSERT_EQ(intResult, ints);
+  details::ChunkPipeline pipeline;
+  ASSERT_TRUE(pipeline.init(dset.getCreateProps().getId(false), sizeof(int)));
+
+  // filter of another tool with the same id isn't taken for h5gt codec
+  DataSetCreateProps foreignProps;
+  const unsigned foreign_values[1] = {sizeof(int)};
+  ASSERT_GE(H5Pset_filter(foreignProps.getId(false), DeltaFilter::id,
+                          H5Z_FLAG_MANDATORY, 1, foreign_values), 0);
+  ASSERT_FALSE(pipeline.init(foreignProps.getId(false), sizeof(int)));
+
+  // lossless for integers
+  DataSetCreateProps soProps;
+  soProps.setChunk({16, 16});
+  soProps.setScaleOffset(H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT);
+  dset = file.createDataSet<int>("scaleoffset", DataSpace(dims), LinkCreateProps::Default(), soProps);
+  dset.write_raw(ints.data());
+  dset.read(intResult.data());
+  ASSERT_EQ(intResult, ints);
+
+  // lossy for floats
+  soProps.removeFilter(H5Z_FILTER_SCALEOFFSET);
+  soProps.setScaleOffset(H5Z_SO_FLOAT_DSCALE, 2);
+  dset = file.createDataSet<float>("scaleoffset_float", DataSpace(dims), LinkCreateProps::Default(), soProps);
+  dset.write_raw(data.data());
+  dset.read(result.data());
+  for (size_t i = 0; i < data.size(); i++)
+    ASSERT_NEAR(result[i], data[i], 0.01);
+
+  DataSetCreateProps nbitProps;
+  nbitProps.setChunk({16, 16});
+  nbitProps.setNBit();
+  DataType nbitType = DataType::FromId(H5Tcopy(H5T_NATIVE_INT));
+  H5Tset_precision(nbitType.getId(false), 20);
+  dset = file.createDataSet("nbit", DataSpace(dims), nbitType, LinkCreateProps::Default(), nbitProps);
+  dset.write_raw(ints.data());
+  dset.read(intResult.data());
+  ASSERT_EQ(intResult, ints);
+  ASSERT_TRUE(dset.getCreateProps().hasFilter(H5Z_FILTER_NBIT));
+
+  // mandatory filter must be registered
+  DataSetCreateProps badProps;
+  ASSERT_THROW(badProps.setFilter(400), PropertyException);
+  badProps.setFilter(400, H5Z_FLAG_OPTIONAL);
+  ASSERT_EQ(badProps.getFilters()[0].getFilterConfig(), 0);
+}
+
+TEST(H5GTBase, AllocFillTime) {
+  File file("h5_alloc_fill_time.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  DataSetCreateProps props;
+  props.setChunk({10, 10});
+  props.setDeflate(1);
+  EXPECT_EQ(props.getAllocTime(), H5D_ALLOC_TIME_INCR);
+  EXPECT_EQ(props.getFillTime(), H5D_FILL_TIME_IFSET);
+  props.setAllocTime(H5D_ALLOC_TIME_EARLY);
+  props.setFillTime(H5D_FILL_TIME_NEVER);
+  EXPECT_EQ(props.getAllocTime(), H5D_ALLOC_TIME_EARLY);
+  EXPECT_EQ(props.getFillTime(), H5D_FILL_TIME_NEVER);
+
+  DataSet dset = file.createDataSet<int>(
+        "early", DataSpace({40, 20}), LinkCreateProps::Default(), props);
+  EXPECT_EQ(dset.listChunks().size(), 8);
+
+  std::vector<int> values(40 * 20);
+  std::iota(values.begin(), values.end(), 0);
+  dset.writeParallel(values.data(), {0, 0}, {40, 20}, 2);
+  std::vector<int> result(values.size());
+  dset.read(result.data());
+  EXPECT_EQ(result, values);
+
+  DataSetCreateProps lazy;
+  lazy.setChunk({10, 10});
+  DataSet dset2 = file.createDataSet<int>(
+        "lazy", DataSpace({40, 20}), LinkCreateProps::Default(), lazy);
+  EXPECT_TRUE(dset2.listChunks().empty());
+}
+
 TEST(H5GTBase, SoftLink) {
   int val_in = 371;
   int val_out = 0;
@@ -1880,6 +2863,208 @@ EnumType<DirectionUType> create_enum_direction() {
 }
 H5GT_REGISTER_TYPE(Direction, create_enum_direction)
 
+TEST(H5GTBase, CompoundFields) {
+  File file("compound_fields_test.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  const size_t n = 5;
+  std::vector<CSL4> records(n);
+  for (size_t i = 0; i < n; i++) {
+    records[i].x = double(i);
+    records[i].y = double(i) * 10;
+    records[i].z = double(i) * 100;
+    records[i].setName("rec_" + std::to_string(i));
+  }
+
+  DataSet dset = file.createDataSet("records", DataSpace::From(records),
+                                    create_compound_csl4());
+  dset.write(records);
+
+  std::vector<double> z, x;
+  std::tie(z, x) = dset.readFields<double, double>({"z", "x"});
+  ASSERT_EQ(z.size(), n);
+  ASSERT_EQ(x.size(), n);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(z[i], records[i].z);
+    ASSERT_EQ(x[i], records[i].x);
+  }
+
+  // converted to the requested member type
+  auto y = std::get<0>(dset.select({1}, {3}).readFields<int>({"y"}));
+  ASSERT_THAT(y, ::testing::ElementsAre(10, 20, 30));
+
+  // other members are left untouched
+  std::vector<double> y_in{-1, -2};
+  dset.select_rows({4, 0}).writeFields({"y"}, std::make_tuple(y_in));
+  std::vector<CSL4> result(n);
+  dset.read(result.data(), create_compound_csl4());
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(result[i].x, records[i].x);
+    ASSERT_EQ(result[i].y, i == 4 ? -1 : i == 0 ? -2 : records[i].y);
+    ASSERT_EQ(result[i].z, records[i].z);
+    ASSERT_EQ(result[i].getName(), records[i].getName());
+  }
+
+  ASSERT_THROW(dset.readFields<double>({"w"}), DataTypeException);
+  ASSERT_THROW(dset.readFields<double>({"x", "y"}), DataTypeException);
+  ASSERT_THROW(dset.writeFields({"x"}, std::make_tuple(y_in)), DataSpaceException);
+
+  DataSet dset_double = file.createDataSet<double>("double", DataSpace(n));
+  ASSERT_THROW(dset_double.readFields<double>({"x"}), DataTypeException);
+}
+
+TEST(H5GTBase, CompoundVLenStrings) {
+  // same members as CT2 with `char*` in place of `std::string`
+  struct CT1Raw {
+    double x;
+    const char* name;
+    const char* family;
+    const char* middlename;
+  };
+
+  struct CT2Raw {
+    int y;
+    const char* film;
+    CT1Raw ct1;
+  };
+
+  CompoundType t_ct1_raw({
+      {"x", AtomicType<double>{}, HOFFSET(CT1Raw, x)},
+      {"name", AtomicType<std::string>{}, HOFFSET(CT1Raw, name)},
+      {"family", AtomicType<std::string>{}, HOFFSET(CT1Raw, family)},
+      {"middlename", AtomicType<std::string>{}, HOFFSET(CT1Raw, middlename)}
+    }, sizeof(CT1Raw));
+  CompoundType t_ct2_raw({
+      {"y", AtomicType<int>{}, HOFFSET(CT2Raw, y)},
+      {"film", AtomicType<std::string>{}, HOFFSET(CT2Raw, film)},
+      {"ct1", t_ct1_raw, HOFFSET(CT2Raw, ct1)}
+    }, sizeof(CT2Raw));
+
+  // big enough to be converted by several threads
+  const size_t n = 20000;
+  std::vector<std::string> names(n);
+  std::vector<CT2Raw> raw(n);
+  for (size_t i = 0; i < n; i++) {
+    names[i] = "name_" + std::to_string(i);
+    raw[i] = {int(i), "Pulp Fiction", {double(i), names[i].c_str(), "Travolta", nullptr}};
+  }
+
+  File file("compound_vlen_strings_test.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet("ct2", DataSpace(n), t_ct2_raw);
+  dset.write_raw(reinterpret_cast<const char*>(raw.data()), t_ct2_raw);
+
+  const std::vector<size_t> offsets =
+      DataTypeRegistry::getVLenStringOffsets<CT2>();
+  ASSERT_THAT(offsets, ::testing::ElementsAre(
+                offsetof(CT2, film),
+                offsetof(CT2, ct1) + offsetof(CT1, name),
+                offsetof(CT2, ct1) + offsetof(CT1, family),
+                offsetof(CT2, ct1) + offsetof(CT1, middlename)));
+
+  std::vector<CT2> result;
+  dset.read(result);
+  ASSERT_EQ(result.size(), n);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(result[i].y, int(i));
+    ASSERT_EQ(result[i].film, "Pulp Fiction");
+    ASSERT_EQ(result[i].ct1.x, double(i));
+    ASSERT_EQ(result[i].ct1.name, names[i]);
+    ASSERT_EQ(result[i].ct1.family, "Travolta");
+    ASSERT_EQ(result[i].ct1.middlename, "");
+  }
+
+  // strings are freed with user's memory manager
+  static size_t n_freed;
+  n_freed = 0;
+  DataTransferProps xferProps;
+  ASSERT_GE(H5Pset_vlen_mem_manager(
+              xferProps.getId(false),
+              [](size_t size, void*) { return std::malloc(size); }, nullptr,
+              [](void* ptr, void*) { n_freed++; std::free(ptr); }, nullptr), 0);
+  dset.select({10}, {5}).read(result, xferProps);
+  ASSERT_EQ(result.size(), 5);
+  ASSERT_EQ(result[0].ct1.name, "name_10");
+  ASSERT_EQ(result[4].film, "Pulp Fiction");
+  ASSERT_EQ(n_freed, 5 * 3);
+}
+
+struct ReflPoint {
+  double x;
+  double y;
+  double z;
+};
+
+struct ReflWell {
+  char name[16];
+  int id;  // followed by padding
+  ReflPoint head;
+  std::array<float, 2> xy;
+  double md[3];
+};
+
+H5GT_REFLECT_PACKED(ReflPoint, x, y, z)
+H5GT_REFLECT(ReflWell, name, id, head, xy, md)
+
+TEST(H5GTBase, Reflect) {
+  static_assert(details::reflection<ReflPoint>::is_packed, "");
+  static_assert(!details::reflection<ReflWell>::is_packed, "");
+
+  DataType well_type = create_and_check_datatype<ReflWell>();
+  ASSERT_EQ(well_type.getClass(), DataTypeClass::Compound);
+  ASSERT_EQ(well_type.getSize(), sizeof(ReflWell));
+  hid_t tid = well_type.getId(false);
+  ASSERT_EQ(H5Tget_nmembers(tid), 5);
+  ASSERT_EQ(H5Tget_member_offset(tid, unsigned(H5Tget_member_index(tid, "head"))),
+            offsetof(ReflWell, head));
+  ASSERT_EQ(H5Tget_member_class(tid, unsigned(H5Tget_member_index(tid, "name"))), H5T_STRING);
+  ASSERT_EQ(H5Tget_member_class(tid, unsigned(H5Tget_member_index(tid, "md"))), H5T_ARRAY);
+
+  // built once
+  DataTypeRegistry::resetCounters();
+  create_and_check_datatype<ReflWell>();
+  ASSERT_EQ(DataTypeRegistry::getMissCount(), 0);
+
+  // packed struct: file and memory datatypes are the same
+  DataType point_type = create_packed_datatype<ReflPoint>();
+  ASSERT_EQ(point_type.getId(false), DataTypeRegistry::get<ReflPoint>().getId(false));
+
+  DataType well_file_type = create_packed_datatype<ReflWell>();
+  ASSERT_EQ(well_file_type.getSize(), 16 + sizeof(int) + 3 * sizeof(double) +
+            2 * sizeof(float) + 3 * sizeof(double));
+
+  const size_t n = 10;
+  std::vector<ReflWell> wells(n);
+  for (size_t i = 0; i < n; i++) {
+    std::snprintf(wells[i].name, sizeof(wells[i].name), "well_%zu", i);
+    wells[i].id = int(i);
+    wells[i].head = {double(i), double(i) + 0.5, -double(i)};
+    wells[i].xy = {float(i), float(i) * 2};
+    wells[i].md[0] = 1; wells[i].md[1] = 2; wells[i].md[2] = double(i);
+  }
+
+  File file("reflect_test.h5", File::ReadWrite | File::Create | File::Truncate);
+  DataSet dset = file.createDataSet("wells", DataSpace::From(wells), well_file_type);
+  dset.write(wells);
+
+  std::vector<ReflWell> result;
+  dset.read(result);
+  ASSERT_EQ(result.size(), n);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_STREQ(result[i].name, wells[i].name);
+    ASSERT_EQ(result[i].id, wells[i].id);
+    ASSERT_EQ(result[i].head.y, wells[i].head.y);
+    ASSERT_EQ(result[i].xy[1], wells[i].xy[1]);
+    ASSERT_EQ(result[i].md[2], wells[i].md[2]);
+  }
+
+  std::vector<ReflPoint> points(n, {1, 2, 3});
+  DataSet dset_points = file.createDataSet("points", DataSpace::From(points), point_type);
+  dset_points.write(points);
+  ASSERT_GT(H5Tequal(dset_points.getDataType().getId(false), point_type.getId(false)), 0);
+  std::vector<ReflPoint> points_result;
+  dset_points.read(points_result);
+  ASSERT_EQ(points_result[n - 1].z, 3);
+}
+
 TEST(H5GTBase, Enum) {
   const std::string FILE_NAME("enum_test.h5");
   const std::string DATASET_NAME1("/a");
@@ -2014,6 +3199,69 @@ TEST(H5GTBase, FixedString) {
   }
 }
 
+TEST(H5GTBase, StringTable) {
+  File file("string_table.h5", File::ReadWrite | File::Create | File::Truncate);
+
+  // long enough to overflow the initial arena
+  std::vector<std::string> strings{"a", "", "well_1", std::string(100, 'x'), "trace label"};
+  DataSet dset = file.createDataSet<std::string>("str", DataSpace::From(strings));
+  dset.write(strings);
+
+  StringTable table;
+  dset.read(table);
+  ASSERT_EQ(table.size(), strings.size());
+  for (size_t i = 0; i < strings.size(); i++) {
+    ASSERT_EQ(table[i], strings[i]);
+    ASSERT_EQ(table.data()[table.getOffsets()[i + 1] - 1], '\0');
+  }
+  ASSERT_THAT(std::vector<std::string_view>(table.begin(), table.end()),
+              ::testing::ElementsAreArray(strings));
+  ASSERT_THROW(table.at(strings.size()), std::out_of_range);
+
+  // contiguous strings are read in place: the arena is reused
+  std::vector<std::string> short_strings(1000);
+  for (size_t i = 0; i < short_strings.size(); i++)
+    short_strings[i] = "s" + std::to_string(i);
+  DataSet dset_short = file.createDataSet<std::string>(
+        "short", DataSpace::From(short_strings));
+  dset_short.write(short_strings);
+  dset_short.read(table);
+  ASSERT_EQ(table.size(), short_strings.size());
+  const char* arena = table.data();
+  dset_short.select({10}, {3}).read(table);
+  ASSERT_EQ(table.data(), arena);
+  ASSERT_THAT(std::vector<std::string_view>(table.begin(), table.end()),
+              ::testing::ElementsAre("s10", "s11", "s12"));
+
+  // unordered selection
+  dset_short.select_rows({7, 3}).read(table);
+  ASSERT_THAT(std::vector<std::string_view>(table.begin(), table.end()),
+              ::testing::ElementsAre("s7", "s3"));
+
+  // write
+  dset.select({1}, {2}).write(StringTable{"b", "c"});
+  std::vector<std::string> result;
+  dset.read(result);
+  ASSERT_THAT(result, ::testing::ElementsAre("a", "b", "c", strings[3], "trace label"));
+  ASSERT_THROW(dset.write(StringTable{"b"}), DataSpaceException);
+
+  // fixed length strings
+  DataSet dset_fixed = file.createDataSet<char[4]>("fixed", DataSpace(2));
+  char raw_strings[][4] = {"abc", "d"};
+  dset_fixed.write(raw_strings);
+  dset_fixed.read(table);
+  ASSERT_THAT(std::vector<std::string_view>(table.begin(), table.end()),
+              ::testing::ElementsAre("abc", "d"));
+
+  // table is left empty (not dangling) if the read fails
+  DataSet dset_int = file.createDataSet<int>("int", DataSpace(3));
+  ASSERT_THROW(dset_int.read(table), DataSetException);
+  ASSERT_TRUE(table.empty());
+  dset_short.select({10}, {2}).read(table);
+  ASSERT_THAT(std::vector<std::string_view>(table.begin(), table.end()),
+              ::testing::ElementsAre("s10", "s11"));
+}
+
 TEST(H5GTBase, FixedLenStringArrayStructure) {
 
   using fixed_array_t = FixedLenStringArray<10>;
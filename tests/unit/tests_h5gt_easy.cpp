@@ -121,6 +121,25 @@ TEST(H5GTEasy, H5Easy_vector2d_compression)
   ASSERT_EQ(a == a_r, true);
 }
 
+TEST(H5GTEasy, H5Easy_vector1d_transfer_props)
+{
+  H5Easy::File file("test.h5", H5Easy::File::Overwrite);
+
+  std::vector<double> a = {1, 2, 3, 4, 5};
+
+  H5Easy::DataTransferProps writeProps;
+  writeProps.setDataTransform("x+1");
+  H5Easy::dump(file, "/path/to/a", a, H5Easy::DumpOptions(writeProps));
+
+  H5Easy::DataTransferProps readProps;
+  readProps.setDataTransform("x-1");
+  std::vector<double> a_r = H5Easy::load<std::vector<double>>(file, "/path/to/a", readProps);
+
+  ASSERT_EQ(a == a_r, true);
+  ASSERT_EQ(H5Easy::load<double>(file, "/path/to/a", {1}), 3);
+  ASSERT_EQ(H5Easy::load<double>(file, "/path/to/a", {1}, readProps), 2);
+}
+
 TEST(H5GTEasy, H5Easy_vector3d)
 {
   H5Easy::File file("test.h5", H5Easy::File::Overwrite);
@@ -7,12 +7,17 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
+#include <h5gt/H5AggregatingWriter.hpp>
 #include <h5gt/H5File.hpp>
 #include <h5gt/H5DataSet.hpp>
 #include <h5gt/H5DataSpace.hpp>
@@ -82,7 +87,6 @@ void selectionArraySimpleTestParallel() {
 }
 
 TEST(H5GTParallel, selectionArraySimple) {
-  MPI_Init(NULL, NULL);
 //  selectionArraySimpleTestParallel<std::string>();
   selectionArraySimpleTestParallel<int>();
   selectionArraySimpleTestParallel<unsigned>();
@@ -91,5 +95,381 @@ TEST(H5GTParallel, selectionArraySimple) {
   selectionArraySimpleTestParallel<float>();
   selectionArraySimpleTestParallel<double>();
   selectionArraySimpleTestParallel<std::complex<double> >();
-  MPI_Finalize();
+}
+
+TEST(H5GTParallel, collectiveTransfer) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRows = 8, nCols = 100;
+  const auto rank = static_cast<size_t>(mpi_rank);
+  const auto size = static_cast<size_t>(mpi_size);
+
+  MPIOFileDriver fapl(MPI_COMM_WORLD, MPI_INFO_NULL);
+  fapl.setAllCollMetadataOps(true);
+  fapl.setCollMetadataWrite(true);
+  EXPECT_TRUE(fapl.getAllCollMetadataOps());
+  EXPECT_TRUE(fapl.getCollMetadataWrite());
+
+  File file("h5_collective_transfer_test.h5",
+            File::ReadWrite | File::Create | File::Truncate, fapl);
+
+  DataTransferProps collective;
+  collective.setMpioTransferMode(H5FD_MPIO_COLLECTIVE);
+  EXPECT_EQ(collective.getMpioTransferMode(), H5FD_MPIO_COLLECTIVE);
+
+  // each rank writes its own block of rows
+  std::vector<double> values(nRows * nCols);
+  for (size_t i = 0; i < values.size(); i++)
+    values[i] = double(rank * values.size() + i);
+
+  DataSet contiguous = file.createDataSet<double>(
+        "contiguous", DataSpace({nRows * size, nCols}));
+  contiguous.select({rank * nRows, 0}, {nRows, nCols})
+      .write_raw(values.data(), AtomicType<double>(), collective);
+  EXPECT_EQ(collective.getMpioActualIoMode(), H5D_MPIO_CONTIGUOUS_COLLECTIVE);
+
+  uint32_t localCause, globalCause;
+  collective.getMpioNoCollectiveCause(localCause, globalCause);
+  EXPECT_EQ(localCause, uint32_t(H5D_MPIO_COLLECTIVE));
+  EXPECT_EQ(globalCause, uint32_t(H5D_MPIO_COLLECTIVE));
+
+  // independent transfer is reported as such
+  DataTransferProps independent;
+  EXPECT_EQ(independent.getMpioTransferMode(), H5FD_MPIO_INDEPENDENT);
+  std::vector<double> result(values.size());
+  contiguous.select({rank * nRows, 0}, {nRows, nCols})
+      .read(result.data(), AtomicType<double>(), independent);
+  EXPECT_EQ(result, values);
+  EXPECT_EQ(independent.getMpioActualIoMode(), H5D_MPIO_NO_COLLECTIVE);
+  independent.getMpioNoCollectiveCause(localCause, globalCause);
+  EXPECT_TRUE(localCause & H5D_MPIO_SET_INDEPENDENT);
+
+  // all chunks in a single MPI-IO call
+  DataSetCreateProps props;
+  props.setChunk({nRows, nCols});
+  DataSet chunked = file.createDataSet<double>(
+        "chunked", DataSpace({nRows * size, nCols}),
+        LinkCreateProps::Default(), props);
+  collective.setMpioChunkOpt(H5FD_MPIO_CHUNK_ONE_IO);
+  chunked.select({rank * nRows, 0}, {nRows, nCols})
+      .write_raw(values.data(), AtomicType<double>(), collective);
+  EXPECT_EQ(collective.getMpioActualIoMode(), H5D_MPIO_CHUNK_COLLECTIVE);
+  EXPECT_EQ(collective.getMpioActualChunkOptMode(), H5D_MPIO_LINK_CHUNK);
+
+  std::fill(result.begin(), result.end(), 0);
+  chunked.select({rank * nRows, 0}, {nRows, nCols})
+      .read(result.data(), AtomicType<double>(), collective);
+  EXPECT_EQ(result, values);
+}
+
+// Independent vs collective write of interleaved rows: rank `r` owns rows
+// `r, r + size, r + 2 * size...`, so independent I/O issues one small
+// request per row and per rank while collective I/O aggregates them.
+// Scaling is observed by running the test with growing number of ranks:
+// mpirun -np <N> ./H5GTTest --gtest_filter=H5GTParallel.collectiveScaling
+TEST(H5GTParallel, collectiveScaling) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRowsPerRank = 256, nCols = 256, nRepeats = 3;
+  const auto rank = static_cast<size_t>(mpi_rank);
+  const auto size = static_cast<size_t>(mpi_size);
+
+  MPIOFileDriver fapl(MPI_COMM_WORLD, MPI_INFO_NULL);
+  fapl.setAllCollMetadataOps(true);
+  fapl.setCollMetadataWrite(true);
+  File file("h5_collective_scaling_test.h5",
+            File::ReadWrite | File::Create | File::Truncate, fapl);
+  DataSet dset = file.createDataSet<float>(
+        "data", DataSpace({nRowsPerRank * size, nCols}));
+  Selection slice = dset.select(
+        {rank, 0}, {nRowsPerRank, nCols}, {size, 1});
+
+  std::vector<float> values(nRowsPerRank * nCols, float(rank));
+
+  auto measure = [&](DataTransferProps& xfer) {
+    double best = 0;
+    for (size_t i = 0; i < nRepeats; i++) {
+      MPI_Barrier(MPI_COMM_WORLD);
+      double start = MPI_Wtime();
+      slice.write_raw(values.data(), AtomicType<float>(), xfer);
+      file.flush();
+      double elapsed = MPI_Wtime() - start, slowest;
+      MPI_Allreduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      best = i == 0 ? slowest : std::min(best, slowest);
+    }
+    return best;
+  };
+
+  DataTransferProps independent;
+  double independentTime = measure(independent);
+
+  DataTransferProps collective;
+  collective.setMpioTransferMode(H5FD_MPIO_COLLECTIVE);
+  double collectiveTime = measure(collective);
+  EXPECT_NE(collective.getMpioActualIoMode(), H5D_MPIO_NO_COLLECTIVE);
+
+  std::vector<float> result(values.size());
+  slice.read(result.data(), AtomicType<float>(), collective);
+  EXPECT_EQ(result, values);
+
+  if (mpi_rank == 0) {
+    const double mib = double(values.size() * sizeof(float) * size) / (1 << 20);
+    std::cout << "ranks: " << mpi_size
+              << ", independent: " << mib / independentTime << " MiB/s"
+              << ", collective: " << mib / collectiveTime << " MiB/s"
+              << std::endl;
+  }
+}
+
+// Deflate-compressed datasets can only be written collectively
+// (HDF5 >= 1.10.2): each rank compresses the chunks it owns
+TEST(H5GTParallel, compressedCollectiveWrite) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRows = 16, nCols = 64;
+  const auto rank = static_cast<size_t>(mpi_rank);
+  const auto size = static_cast<size_t>(mpi_size);
+
+  File file("h5_compressed_collective_test.h5",
+            File::ReadWrite | File::Create | File::Truncate,
+            MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+
+  DataSetCreateProps props;
+  props.setChunk({nRows, nCols});
+  props.setShuffle();
+  props.setDeflate(4);
+  props.setFillTime(H5D_FILL_TIME_NEVER);
+
+  DataTransferProps collective;
+  collective.setMpioTransferMode(H5FD_MPIO_COLLECTIVE);
+
+  // smooth data so that compression is noticeable
+  std::vector<int> values(nRows * nCols);
+  for (size_t i = 0; i < values.size(); i++)
+    values[i] = int(rank * 1000 + i / 8);
+
+  // every rank writes its block of rows through `Selection::write`
+  DataSet blocks = file.createDataSet<int>(
+        "blocks", DataSpace({nRows * size, nCols}),
+        LinkCreateProps::Default(), props);
+  EXPECT_TRUE(blocks.getCreateProps().hasFilter(H5Z_FILTER_DEFLATE));
+  blocks.select({rank * nRows, 0}, {nRows, nCols})
+      .write_raw(values.data(), AtomicType<int>(), collective);
+  EXPECT_EQ(collective.getMpioActualIoMode(), H5D_MPIO_CHUNK_COLLECTIVE);
+
+  // every rank writes the whole dataset through `DataSet::write`
+  // (the same data, so the result doesn't depend on the order)
+  std::vector<std::vector<int>> matrix(nRows, std::vector<int>(nCols));
+  for (size_t i = 0; i < nRows; i++)
+    for (size_t j = 0; j < nCols; j++)
+      matrix[i][j] = int(i * nCols + j);
+  DataSet whole = file.createDataSet<int>(
+        "whole", DataSpace({nRows, nCols}), LinkCreateProps::Default(), props);
+  whole.write(matrix, collective);
+  file.flush();
+
+  EXPECT_LT(blocks.getStorageSize(), nRows * nCols * size * sizeof(int));
+
+  std::vector<int> result(values.size());
+  blocks.select({rank * nRows, 0}, {nRows, nCols})
+      .read(result.data(), AtomicType<int>(), collective);
+  EXPECT_EQ(result, values);
+
+  // `readParallel` falls back to collective read with MPI-IO
+  result.assign(values.size(), 0);
+  blocks.select({rank * nRows, 0}, {nRows, nCols})
+      .readParallel(result.data(), 0, AtomicType<int>(), collective);
+  EXPECT_EQ(result, values);
+
+  std::vector<std::vector<int>> matrixResult;
+  whole.read(matrixResult, collective);
+  EXPECT_EQ(matrixResult, matrix);
+}
+
+// Throughput of collective writes of unfiltered and deflated chunks:
+// mpirun -np <N> ./H5GTTest --gtest_filter=H5GTParallel.compressedCollectiveThroughput
+TEST(H5GTParallel, compressedCollectiveThroughput) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRowsPerRank = 512, nCols = 512, nRepeats = 3;
+  const auto rank = static_cast<size_t>(mpi_rank);
+  const auto size = static_cast<size_t>(mpi_size);
+
+  File file("h5_compressed_collective_throughput.h5",
+            File::ReadWrite | File::Create | File::Truncate,
+            MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+
+  std::vector<float> values(nRowsPerRank * nCols);
+  for (size_t i = 0; i < values.size(); i++)
+    values[i] = std::sin(float(i % nCols) * 0.01f) * float(rank + 1);
+
+  DataTransferProps collective;
+  collective.setMpioTransferMode(H5FD_MPIO_COLLECTIVE);
+
+  auto measure = [&](const std::string& name, DataSetCreateProps& props) {
+    double best = 0;
+    for (size_t i = 0; i < nRepeats; i++) {
+      DataSet dset = file.createDataSet<float>(
+            name + std::to_string(i), DataSpace({nRowsPerRank * size, nCols}),
+            LinkCreateProps::Default(), props);
+      MPI_Barrier(MPI_COMM_WORLD);
+      double start = MPI_Wtime();
+      dset.select({rank * nRowsPerRank, 0}, {nRowsPerRank, nCols})
+          .write_raw(values.data(), AtomicType<float>(), collective);
+      file.flush();
+      double elapsed = MPI_Wtime() - start, slowest;
+      MPI_Allreduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      best = i == 0 ? slowest : std::min(best, slowest);
+    }
+    if (mpi_rank == 0) {
+      const double mib = double(values.size() * sizeof(float) * size) / (1 << 20);
+      std::cout << "ranks: " << mpi_size << ", " << name << ": "
+                << mib / best << " MiB/s" << std::endl;
+    }
+  };
+
+  DataSetCreateProps raw;
+  raw.setChunk({64, nCols});
+  measure("raw", raw);
+
+  DataSetCreateProps deflated;
+  deflated.setChunk({64, nCols});
+  deflated.setShuffle();
+  deflated.setDeflate(1);
+  deflated.setFillTime(H5D_FILL_TIME_NEVER);
+  measure("shuffle + deflate(1)", deflated);
+}
+
+// Every rank writes single rows scattered over the dataset (rank `r` owns
+// rows `r, r + size...`) split into a few pieces. Run with i.e.
+// mpirun -np 8 ./H5GTTest --gtest_filter=H5GTParallel.aggregatingWriter*
+template <typename F>
+static void writeScatteredRows(size_t nRows, size_t nCols, F&& write) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t half = nCols / 2;
+  std::vector<int> piece;
+  for (size_t i = size_t(mpi_rank); i < nRows; i += size_t(mpi_size)) {
+    for (size_t first : {half, size_t(0)}) {
+      const size_t count = first == 0 ? half : nCols - half;
+      piece.resize(count);
+      for (size_t j = 0; j < count; j++)
+        piece[j] = int(i * nCols + first + j);
+      write(piece, std::vector<size_t>{i, first}, std::vector<size_t>{1, count});
+    }
+  }
+}
+
+TEST(H5GTParallel, aggregatingWriter) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRows = 50 * size_t(mpi_size), nCols = 30;
+
+  File file("h5_aggregating_writer_test.h5",
+            File::ReadWrite | File::Create | File::Truncate,
+            MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+
+  DataSet contiguous = file.createDataSet<int>(
+        "contiguous", DataSpace({nRows, nCols}));
+
+  DataSetCreateProps props;
+  props.setChunk({16, nCols});
+  props.setDeflate(1);
+  DataSet chunked = file.createDataSet<int>(
+        "chunked", DataSpace({nRows, nCols}), LinkCreateProps::Default(), props);
+
+  const int nAggregators = std::max(1, mpi_size / 2);
+  for (DataSet& dset : {std::ref(contiguous), std::ref(chunked)}) {
+    AggregatingWriter<int> writer(dset, MPI_COMM_WORLD, nAggregators, 256);
+    EXPECT_EQ(writer.getAggregators().size(), size_t(nAggregators));
+    EXPECT_EQ(writer.getDomains().front(), 0u);
+    EXPECT_EQ(writer.getDomains().back(), nRows);
+
+    writeScatteredRows(nRows, nCols, [&](const std::vector<int>& piece,
+                       const std::vector<size_t>& offset,
+                       const std::vector<size_t>& count) {
+      writer.write(piece, offset, count);
+    });
+    EXPECT_GT(writer.getBufferedSize(), 0);
+    writer.flush();
+    EXPECT_EQ(writer.getBufferedSize(), 0);
+
+    // a chunk is written by a single aggregator
+    if (dset.getCreateProps().isChunked()) {
+      for (size_t i = 1; i + 1 < writer.getDomains().size(); i++)
+        EXPECT_EQ(writer.getDomains()[i] % 16, 0);
+    }
+  }
+  file.flush();
+
+  std::vector<int> expected(nRows * nCols), result(nRows * nCols);
+  std::iota(expected.begin(), expected.end(), 0);
+  contiguous.read(result.data());
+  EXPECT_EQ(result, expected);
+  chunked.read(result.data());
+  EXPECT_EQ(result, expected);
+}
+
+// Naive independent writes of scattered rows vs aggregated writes:
+// mpirun -np 8 ./H5GTTest --gtest_filter=H5GTParallel.aggregatingWriterThroughput
+TEST(H5GTParallel, aggregatingWriterThroughput) {
+  int mpi_rank, mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  const size_t nRows = 2048 * size_t(mpi_size), nCols = 64;
+
+  File file("h5_aggregating_writer_throughput.h5",
+            File::ReadWrite | File::Create | File::Truncate,
+            MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+
+  auto measure = [&](const std::string& name, const std::function<void(DataSet&)>& write) {
+    DataSet dset = file.createDataSet<int>(name, DataSpace({nRows, nCols}));
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    write(dset);
+    file.flush();
+    double elapsed = MPI_Wtime() - start, slowest;
+    MPI_Allreduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    if (mpi_rank == 0) {
+      const double mib = double(nRows * nCols * sizeof(int)) / (1 << 20);
+      std::cout << "ranks: " << mpi_size << ", " << name << ": "
+                << mib / slowest << " MiB/s" << std::endl;
+    }
+  };
+
+  measure("naive", [&](DataSet& dset) {
+    writeScatteredRows(nRows, nCols, [&](const std::vector<int>& piece,
+                       const std::vector<size_t>& offset,
+                       const std::vector<size_t>& count) {
+      dset.select(offset, count).write_raw(piece.data());
+    });
+  });
+
+  measure("aggregated", [&](DataSet& dset) {
+    AggregatingWriter<int> writer(dset, MPI_COMM_WORLD);
+    writeScatteredRows(nRows, nCols, [&](const std::vector<int>& piece,
+                       const std::vector<size_t>& offset,
+                       const std::vector<size_t>& count) {
+      writer.write(piece, offset, count);
+    });
+    writer.flush();
+  });
+
+  std::vector<int> expected(nRows * nCols), result(nRows * nCols);
+  std::iota(expected.begin(), expected.end(), 0);
+  file.getDataSet("aggregated").read(result.data());
+  EXPECT_EQ(result, expected);
 }